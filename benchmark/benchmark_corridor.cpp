@@ -0,0 +1,163 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include "corridor/corridor.h"
+#include "corridor/corridor_assignment/corridor_assignment.h"
+#include "corridor/cubic_spline/cubic_spline.h"
+#include "corridor/unscented_transformation/polar_coordinate_transformation.h"
+
+using namespace corridor;
+namespace cs = corridor::cubic_spline;
+
+namespace {
+
+// Gently curved reference line of the given node count, roughly 2 m node
+// spacing as produced by typical map data
+CartesianPoints2D MakeReferenceLine(const int num_nodes) {
+  CartesianPoints2D points;
+  points.reserve(num_nodes);
+  for (int i = 0; i < num_nodes; i++) {
+    const RealType x = 2.0 * static_cast<RealType>(i);
+    points.emplace_back(x, 5.0 * std::sin(0.02 * x));
+  }
+  return points;
+}
+
+Corridor MakeCorridor(const int num_nodes) {
+  CartesianPoints2D reference_line = MakeReferenceLine(num_nodes);
+  CartesianPoints2D left_boundary;
+  CartesianPoints2D right_boundary;
+  left_boundary.reserve(num_nodes);
+  right_boundary.reserve(num_nodes);
+  for (const CartesianPoint2D& point : reference_line) {
+    left_boundary.emplace_back(point.x(), point.y() + 2.0);
+    right_boundary.emplace_back(point.x(), point.y() - 2.0);
+  }
+  return Corridor(1, reference_line, left_boundary, right_boundary);
+}
+
+// Query points scattered around the reference line, fixed seed for
+// comparable runs
+Eigen::Matrix<RealType, 2, Eigen::Dynamic> MakeQueryPoints(
+    const int num_points, const RealType max_x) {
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<RealType> x_distribution(0.0, max_x);
+  std::uniform_real_distribution<RealType> y_distribution(-8.0, 8.0);
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> points(2, num_points);
+  for (int i = 0; i < num_points; i++) {
+    points(0, i) = x_distribution(generator);
+    points(1, i) = y_distribution(generator);
+  }
+  return points;
+}
+
+}  // namespace
+
+// Spline construction (natural spline fit incl. arc-length approximation)
+// as a function of the node count
+static void BM_CubicSplineConstruction(benchmark::State& state) {
+  const CartesianPoints2D points = MakeReferenceLine(state.range(0));
+  for (auto _ : state) {
+    cs::CubicSpline spline(1, points);
+    benchmark::DoNotOptimize(spline.GetTotalLength());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_CubicSplineConstruction)->Arg(10)->Arg(50)->Arg(200)->Arg(1000);
+
+// Single-point projection: segment candidate search plus root finding
+static void BM_SinglePointProjection(benchmark::State& state) {
+  const CartesianPoints2D nodes = MakeReferenceLine(100);
+  const cs::CubicSpline spline(1, nodes);
+  const auto queries = MakeQueryPoints(1024, spline.GetTotalLength());
+  int index = 0;
+  for (auto _ : state) {
+    const CartesianPoint2D point = queries.col(index);
+    index = (index + 1) % queries.cols();
+    benchmark::DoNotOptimize(spline.getFrenetPositionWithFrame(point));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_SinglePointProjection);
+
+// Batched projection of a whole point set (ConvertToFrenetPolyline path)
+static void BM_BatchProjection(benchmark::State& state) {
+  const CartesianPoints2D nodes = MakeReferenceLine(100);
+  const cs::CubicSpline spline(1, nodes);
+  const auto queries =
+      MakeQueryPoints(state.range(0), spline.GetTotalLength());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(spline.projectPoints(queries));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BatchProjection)->Arg(100)->Arg(1000)->Arg(10000);
+
+// Corridor width lookup along the reference line
+static void BM_CorridorWidthAt(benchmark::State& state) {
+  const Corridor corridor = MakeCorridor(100);
+  const RealType length = corridor.lengthReferenceLine();
+  RealType arc_length = 0.0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(corridor.widthAt(arc_length));
+    arc_length += 1.37;
+    if (arc_length > length) {
+      arc_length -= length;
+    }
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CorridorWidthAt);
+
+// Full assignment confidence of one object against one corridor, including
+// the feature computation (projection, boundary lookup)
+static void BM_AssignmentConfidence(benchmark::State& state) {
+  const Corridor corridor = MakeCorridor(100);
+  const CartesianState2D cartesian_state(
+      CartesianPoint2D(50.0, 1.0), CartesianVector2D(10.0, 0.5),
+      CovarianceMatrix2D(0.4, 0.4), CovarianceMatrix2D(0.1, 0.1));
+  const OrientedBoundingBox oriented_bounding_box(0.1, 4.5, 1.8);
+  for (auto _ : state) {
+    const CorridorRelatedFeatures features =
+        ComputeCorridorRelatedObjectFeature(cartesian_state,
+                                            oriented_bounding_box, corridor);
+    benchmark::DoNotOptimize(ComputeAssignmentConfidence(features));
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AssignmentConfidence);
+
+// Polar velocity transformation, small uncertainty (linearized fast path)
+static void BM_PolarTransformationLinearized(benchmark::State& state) {
+  const Eigen::Vector2d mean(10.0, 5.0);
+  const Eigen::Matrix2d cov_mat = Eigen::Matrix2d::Identity() * 0.01;
+  PolarVector2D polar_mean;
+  PolarCovarianceMatrix2D polar_cov_mat;
+  for (auto _ : state) {
+    unscented_transformation::ToPolarCoordinates2D(mean, cov_mat, &polar_mean,
+                                                   &polar_cov_mat);
+    benchmark::DoNotOptimize(polar_mean);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PolarTransformationLinearized);
+
+// Polar velocity transformation, large uncertainty (unscented fallback)
+static void BM_PolarTransformationUnscented(benchmark::State& state) {
+  const Eigen::Vector2d mean(1.0, 0.5);
+  const Eigen::Matrix2d cov_mat = Eigen::Matrix2d::Identity() * 0.5;
+  PolarVector2D polar_mean;
+  PolarCovarianceMatrix2D polar_cov_mat;
+  for (auto _ : state) {
+    unscented_transformation::ToPolarCoordinates2D(mean, cov_mat, &polar_mean,
+                                                   &polar_cov_mat);
+    benchmark::DoNotOptimize(polar_mean);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_PolarTransformationUnscented);
+
+BENCHMARK_MAIN();
@@ -20,7 +20,22 @@ using Ids = std::vector<IdType>;
 
 using IdxType = size_t;
 
+// Floating-point type of all geometric quantities in the library. Defaults
+// to double; building with -DCORRIDOR_REAL_TYPE_FLOAT switches the library
+// to single precision, which halves the memory bandwidth of the data
+// matrices and doubles the SIMD width on embedded targets where
+// centimeter-level accuracy is sufficient.
+#ifdef CORRIDOR_REAL_TYPE_FLOAT
+using RealType = float;
+#else
 using RealType = double;
+#endif
+
+// The spline moment systems are solved in this type independently of
+// RealType: the tridiagonal solve is the numerically most sensitive step of
+// the spline fit, and keeping it in double costs only a few transient
+// vectors per fit while the data matrices stay in RealType.
+using SolverRealType = double;
 
 // Currently double, lets find a better representation later
 using TimeStampType = double;
@@ -16,6 +16,12 @@ using CartesianVector2D = BasicVector2D;
 using CartesianPoints2D = std::vector<CartesianPoint2D>;
 using CartesianVectors2D = std::vector<CartesianVector2D>;
 
+//! Matrix with one Cartesian point per column
+using CartesianPointsMatrix2D = Eigen::Matrix<RealType, 2, Eigen::Dynamic>;
+//! Non-owning view on externally held points (one point per column), e.g.
+//! contiguous map-layer buffers; avoids materializing a point vector
+using CartesianPointsView2D = Eigen::Map<const CartesianPointsMatrix2D>;
+
 // /////////////////////////////////////////////////////////////////////////////
 // Cartesian state vector and covariances
 // /////////////////////////////////////////////////////////////////////////////
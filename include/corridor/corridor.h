@@ -1,6 +1,8 @@
 #pragma once
 
-#include <map>
+#include <algorithm>
+#include <utility>
+#include <vector>
 
 #include "corridor/basic_types.h"
 #include "corridor/cartesian_types.h"
@@ -21,6 +23,18 @@ using CorridorPtrs = std::vector<CorridorPtr>;
  */
 using BoundaryDistances = std::pair<RealType, RealType>;
 
+/**
+ * @brief Signed boundary distances, width and center offset of a corridor at
+ * one arc-length, gathered by a single boundary lookup per side.
+ */
+struct BoundaryInfo {
+  RealType distance_left;   //!< signed distance to the left bound
+  RealType distance_right;  //!< signed distance to the right bound
+  RealType width;           //!< total corridor width
+  RealType center_offset;   //!< offset of the corridor center to the
+                            //!< reference line
+};
+
 class Corridor {
  public:
   Corridor() {}
@@ -85,17 +99,91 @@ class Corridor {
            const CartesianPoints2D& left_boundary_pts,
            const CartesianPoints2D& right_boundary_pts);
 
+  /**
+   * @brief Zero-copy construction from non-owning views on externally held
+   * point buffers (e.g. contiguous map-layer arrays). The reference line is
+   * fitted straight from the view and the boundaries are projected without
+   * materializing point vectors.
+   *
+   * @param id:                  corridor id
+   * @param reference_line_pts   view on the reference line points
+   * @param left_boundary_pts    view on the left boundary points
+   * @param right_boundary_pts   view on the right boundary points
+   */
+  Corridor(const IdType id, const CartesianPointsView2D& reference_line_pts,
+           const CartesianPointsView2D& left_boundary_pts,
+           const CartesianPointsView2D& right_boundary_pts);
+
+  /**
+   * @brief Construct a new Corridor object from already constructed parts,
+   * e.g. when loading serialized corridors. No spline fitting or boundary
+   * conversion is performed.
+   *
+   * @param reference_line   fitted reference line spline
+   * @param left_bound       left boundary, relative to the reference line
+   * @param right_bound      right boundary, relative to the reference line
+   */
+  Corridor(const cubic_spline::CubicSpline& reference_line,
+           const FrenetPolyline& left_bound, const FrenetPolyline& right_bound)
+      : reference_line_(reference_line),
+        left_bound_(left_bound),
+        right_bound_(right_bound) {
+    precomputeDeviationBound();
+  }
+
+  //! Move overload of the parts constructor for callers which hand over
+  //! ownership, e.g. builders assembling corridors in place
+  Corridor(cubic_spline::CubicSpline&& reference_line,
+           FrenetPolyline&& left_bound, FrenetPolyline&& right_bound)
+      : reference_line_(std::move(reference_line)),
+        left_bound_(std::move(left_bound)),
+        right_bound_(std::move(right_bound)) {
+    precomputeDeviationBound();
+  }
+
   //! Get the unique id of underlying reference line
   IdType id() const noexcept { return reference_line_.GetId(); }
 
+  //! Access to the underlying parts, e.g. for serialization
+  const cubic_spline::CubicSpline& referenceLine() const noexcept {
+    return reference_line_;
+  }
+  const FrenetPolyline& leftBound() const noexcept { return left_bound_; }
+  const FrenetPolyline& rightBound() const noexcept { return right_bound_; }
+
   BoundaryDistances signedDistancesAt(const RealType arc_length) const noexcept;
   RealType widthAt(const RealType arc_length) const noexcept;
   RealType centerOffset(const RealType arc_length) const noexcept;
+
+  /**
+   * @brief Fused boundary query: signed distances, width and center offset
+   * from one boundary lookup per side, for callers which need several of
+   * these values at the same arc-length.
+   */
+  BoundaryInfo boundaryInfoAt(const RealType arc_length) const noexcept;
   RealType curvatureAt(const RealType arc_length) const noexcept {
     return reference_line_.GetCurvatureAt(arc_length);
   }
   RealType lengthReferenceLine() const noexcept;
 
+  /**
+   * @brief Conservative prefilter before a full projection: lower bound on
+   * the Euclidean distance between the position and the reference line,
+   * evaluated against the precomputed coarse bounding tube (spline nodes
+   * plus half the maximal segment length). One vectorized node scan instead
+   * of the candidate search and root finding.
+   */
+  RealType minDistanceBound(const CartesianPoint2D& position) const noexcept;
+
+  /**
+   * @brief True if the position could lie inside the corridor, laterally
+   * within the boundaries widened by margin. False only when the point is
+   * provably outside, so callers can skip getFrenetPositionWithFrame and
+   * the assignment pipeline for trivially rejectable object-corridor pairs.
+   */
+  bool canContainPoint(const CartesianPoint2D& position,
+                       const RealType margin = 0.0) const noexcept;
+
   FrenetFrame2D FrenetFrame(const CartesianPoint2D& position) const noexcept;
 
   FrenetPositionWithFrame getFrenetPositionWithFrame(
@@ -111,11 +199,51 @@ class Corridor {
       CartesianPoints2D* right_boundary, const RealType delta_l = 0.1,
       const bool sample_boundaries = true) const noexcept;
 
+  /**
+   * @brief Batch sampling of reference line and boundary polylines into
+   * caller-provided buffers (one sample per column). The reference line is
+   * evaluated segment by segment with vectorized Eigen expressions; the
+   * buffers are only reallocated if the number of samples changed.
+   *
+   * @param delta_l: sampling distance along the reference line [m]
+   * @param reference_polyline  sampled reference line
+   * @param left_polyline       sampled left boundary
+   * @param right_polyline      sampled right boundary
+   * @return number of samples written per polyline
+   */
+  cubic_spline::DataSize sampleCartesianPolylines(
+      const RealType delta_l,
+      Eigen::Matrix<RealType, 2, Eigen::Dynamic>* reference_polyline,
+      Eigen::Matrix<RealType, 2, Eigen::Dynamic>* left_polyline,
+      Eigen::Matrix<RealType, 2, Eigen::Dynamic>* right_polyline)
+      const noexcept;
+
   FrenetPolyline toFrenetPolyline(
       const CartesianPoints2D& cartesian_polyline) const;
 
+  //! Batched overload projecting one point per column onto the reference
+  //! line; Eigen::Ref binds owning matrices and non-owning views alike
+  FrenetPolyline toFrenetPolyline(
+      const Eigen::Ref<const Eigen::Matrix<RealType, 2, Eigen::Dynamic>>&
+          cartesian_points) const;
+
   CartesianPoint2D toCartesianPoint(const FrenetPoint2D& frenet_point) const;
 
+  /**
+   * @brief Batch conversion of Frenet points back to Cartesian coordinates,
+   * the mirror image of toFrenetPolyline. The queries are bucketed by
+   * reference line segment and each segment is evaluated once over all of
+   * its queries, e.g. for the candidate trajectories of a sampling planner.
+   *
+   * @param frenet_points: Frenet points, in arbitrary order
+   * @param cartesian_points: caller-provided buffer, one point per column in
+   * the order of the input. Only reallocated if the number of points changed.
+   * @return number of points written
+   */
+  cubic_spline::DataSize toCartesianPolyline(
+      const FrenetPoints2D& frenet_points,
+      Eigen::Matrix<RealType, 2, Eigen::Dynamic>* cartesian_points) const;
+
  private:
   // Reference line for the frenet frame. Not necessarily a centerline, but
   // has to be located between the left and right boundary.
@@ -126,6 +254,15 @@ class Corridor {
   // flexibility
   FrenetPolyline left_bound_;
   FrenetPolyline right_bound_;
+
+  // Coarse bounding tube for the projection prefilter, precomputed at
+  // construction: any point of the reference line lies within half the
+  // maximal segment arc-length of its nearest spline node, and any point
+  // inside the corridor within the maximal absolute boundary deviation of
+  // the reference line.
+  RealType half_max_segment_length_ = 0.0;
+  RealType max_boundary_deviation_ = 0.0;
+  void precomputeDeviationBound();
 };
 
 // Introspection
@@ -140,21 +277,26 @@ class Corridor {
 class CorridorSequence {
  public:
   CorridorSequence(const CorridorPtrs& corridor_ptrs = CorridorPtrs()) {
+    corridors_.reserve(corridor_ptrs.size());
     RealType offset = 0.0;
-    std::transform(corridor_ptrs.begin(), corridor_ptrs.end(),
-                   std::inserter(corridor_map_, corridor_map_.end()),
-                   [&offset](const CorridorPtr c) {
-                     RealType prev_offset = offset;
-                     offset += c->lengthReferenceLine();
-                     return std::make_pair(prev_offset, c);
-                   });
+    for (const CorridorPtr& corridor_ptr : corridor_ptrs) {
+      corridors_.emplace_back(offset, corridor_ptr);
+      offset += corridor_ptr->lengthReferenceLine();
+    }
   }
 
   //! Returns wether this holds any corridors
-  bool empty() const noexcept { return corridor_map_.empty(); }
+  bool empty() const noexcept { return corridors_.empty(); }
 
   //! Returns number of corridors
-  size_t size() const noexcept { return corridor_map_.size(); }
+  size_t size() const noexcept { return corridors_.size(); }
+
+  //! Appends a corridor at the end of the sequence, e.g. when upcoming route
+  //! corridors are spliced in ready-made by a prefetcher
+  void append(const CorridorPtr& corridor_ptr) {
+    const RealType offset = corridors_.empty() ? 0.0 : totalLength();
+    corridors_.emplace_back(offset, corridor_ptr);
+  }
 
   BoundaryDistances signedDistancesAt(const RealType arc_length) const noexcept;
   RealType widthAt(const RealType arc_length) const noexcept;
@@ -170,29 +312,56 @@ class CorridorSequence {
   friend std::ostream& operator<<(std::ostream& os,
                                   const CorridorPtr& corridor);
 
- private:
-  // key: offset of the corridor to the first corridor
-  // value: pointer to the corridor object
-  using CorridorSequenceMap = std::map<RealType, CorridorPtr>;
-  CorridorSequenceMap corridor_map_;
+  // Stateful cursor for tracked objects needs direct access to the corridors
+  friend class CorridorSequenceCursor;
 
-  // Get corridor with contains the arc_length.
+ private:
+  // Flat sorted sequence: offset of each corridor to the first corridor plus
+  // the corridor itself. A flat vector keeps the binary search cache-friendly
+  // and the last-hit cursor resolves monotone query sequences in O(1).
+  using OffsetCorridorPair = std::pair<RealType, CorridorPtr>;
+  std::vector<OffsetCorridorPair> corridors_;
+  mutable std::size_t cursor_ = 0;
+
+  // Get index of the corridor which contains the arc_length.
   // If it is smaller than zero it will return the first corridor, if it is
-  // bigger than the totalLength() it will return the last CorridorPtr
-  CorridorSequenceMap::const_iterator get(const RealType arc_length) const {
-    CorridorSequenceMap::const_iterator it =
-        corridor_map_.lower_bound(arc_length);
-    assert(!corridor_map_.empty());
-    if (it == corridor_map_.end()) {
-      // If key is larger than the biggest key, return last map entry
-      return std::prev(it);
+  // bigger than the totalLength() it will return the last corridor
+  std::size_t get(const RealType arc_length) const {
+    assert(!corridors_.empty());
+    const std::size_t last_idx = corridors_.size() - 1;
+
+    // True if idx is the entry a lower-bound search would return
+    const auto is_hit = [this, arc_length, last_idx](const std::size_t idx) {
+      const bool no_smaller_entry =
+          (idx == 0) || (corridors_[idx - 1].first < arc_length);
+      const bool covers =
+          (arc_length <= corridors_[idx].first) || (idx == last_idx);
+      return no_smaller_entry && covers;
+    };
+
+    // Last-hit cursor: monotone query sequences stay in the same corridor or
+    // advance to the next one
+    if (is_hit(cursor_)) {
+      return cursor_;
+    }
+    if (cursor_ < last_idx && is_hit(cursor_ + 1)) {
+      return ++cursor_;
     }
-    return it;
+
+    // Cache-friendly binary search over the flat vector
+    const auto iter = std::lower_bound(
+        corridors_.begin(), corridors_.end(), arc_length,
+        [](const OffsetCorridorPair& entry, const RealType value) {
+          return entry.first < value;
+        });
+    cursor_ = (iter == corridors_.end())
+                  ? last_idx
+                  : static_cast<std::size_t>(iter - corridors_.begin());
+    return cursor_;
   }
 
-  FrenetPositionWithFrame getFrenetPositionWithFrame(
-      const CartesianPoint2D& position,
-      CorridorSequenceMap::const_iterator iter) const;
+  FrenetPositionWithFrame getFrenetPositionWithFrameAt(
+      const std::size_t index, const CartesianPoint2D& position) const;
 };
 
 using CorridorPath = CorridorPtrs;
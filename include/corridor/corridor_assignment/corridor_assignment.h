@@ -67,6 +67,118 @@ CorridorRelatedFeatures ComputeCorridorRelatedObjectFeature(
     const CartesianState2D& cartesian_state,
     const OrientedBoundingBox& oriented_bounding_box, const Corridor& corridor);
 
+// /////////////////////////////////////////////////////////////////////////////
+// Lazily evaluated features
+// /////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Lazily evaluated view over (CartesianState2D, OrientedBoundingBox,
+ * Corridor) which computes and memoizes the feature groups on first access:
+ * the Frenet projection (frame, state and reoriented bounding box), the
+ * boundary lookup (corridor width and center offset) and the corridor
+ * length. Cheap gating queries such as a lone
+ * LeftOfLateralAssignmentConfidence stop paying for the groups they never
+ * read; a fully materialized struct is available via features().
+ *
+ * The view references its inputs and must not outlive them.
+ */
+class LazyCorridorRelatedFeatures {
+ public:
+  LazyCorridorRelatedFeatures(const CartesianState2D& cartesian_state,
+                              const OrientedBoundingBox& oriented_bounding_box,
+                              const Corridor& corridor)
+      : cartesian_state_(cartesian_state),
+        oriented_bounding_box_(oriented_bounding_box),
+        corridor_(corridor) {}
+
+  // Lazy field access; each getter triggers at most its own feature group
+  const FrenetFrame2D& frenetFrame() const;
+  const FrenetState2D& frenetState() const;
+  const OrientedBoundingBox& frenetObb() const;
+  RealType corridorWidth() const;
+  RealType corridorCenterOffset() const;
+  RealType corridorLength() const;
+
+  //! Materializes all feature groups
+  const CorridorRelatedFeatures& features() const;
+
+ private:
+  void ensureProjection() const;
+  void ensureBoundary() const;
+  void ensureLength() const;
+
+  const CartesianState2D& cartesian_state_;
+  const OrientedBoundingBox& oriented_bounding_box_;
+  const Corridor& corridor_;
+
+  mutable CorridorRelatedFeatures features_;
+  mutable bool projection_computed_ = false;
+  mutable bool boundary_computed_ = false;
+  mutable bool length_computed_ = false;
+
+  // The confidence overloads touch only the feature groups they need
+  friend RealType LateralAssignmentConfidence(
+      const LazyCorridorRelatedFeatures& features);
+  friend RealType LeftOfLateralAssignmentConfidence(
+      const LazyCorridorRelatedFeatures& features);
+  friend RealType RightOfLateralAssignmentConfidence(
+      const LazyCorridorRelatedFeatures& features);
+  friend RealType LongitudinalAssignmentConfidence(
+      const LazyCorridorRelatedFeatures& features);
+  friend RealType DownstreamLongitudinalAssignmentConfidence(
+      const LazyCorridorRelatedFeatures& features);
+  friend RealType UpstreamLongitudinalAssignmentConfidence(
+      const LazyCorridorRelatedFeatures& features);
+};
+
+// Confidence overloads on the lazy view: identical results to the struct
+// based functions, but only the required feature groups are evaluated
+RealType LateralAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features);
+RealType LeftOfLateralAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features);
+RealType RightOfLateralAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features);
+RealType LongitudinalAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features);
+RealType DownstreamLongitudinalAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features);
+RealType UpstreamLongitudinalAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features);
+RealType ComputeAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features);
+
+// /////////////////////////////////////////////////////////////////////////////
+// Batch assignment engine
+// /////////////////////////////////////////////////////////////////////////////
+
+//! Assignment confidences of all (object, corridor) pairs: one row per
+//! object, one column per corridor
+using AssignmentConfidenceMatrix =
+    Eigen::Matrix<RealType, Eigen::Dynamic, Eigen::Dynamic>;
+
+/**
+ * @brief Evaluates the assignment confidences of all objects against all
+ * candidate corridors in one call. The (object, corridor) pairs are
+ * embarrassingly parallel: the work is partitioned by corridor across a set
+ * of worker threads (claiming pattern as in BuildCorridors), so each worker
+ * reuses the per-corridor state for all of its objects and writes one
+ * confidence column of the preallocated result matrix.
+ *
+ * @param cartesian_states: motion states of the objects
+ * @param oriented_bounding_boxes: bounding boxes of the objects, same order
+ * @param corridors: candidate corridors
+ * @param confidences: caller-provided result matrix, one row per object and
+ * one column per corridor. Only reallocated if the dimensions changed.
+ * @param num_threads: number of worker threads; 0 selects the hardware
+ * concurrency. Clamped to the number of corridors.
+ */
+void AssignObjectsToCorridors(
+    const std::vector<CartesianState2D>& cartesian_states,
+    const std::vector<OrientedBoundingBox>& oriented_bounding_boxes,
+    const CorridorPtrs& corridors, AssignmentConfidenceMatrix* confidences,
+    const std::size_t num_threads = 0);
+
 // /////////////////////////////////////////////////////////////////////////////
 // // Lateral and Longitudinal assignment confidences
 // /////////////////////////////////////////////////////////////////////////////
@@ -140,6 +252,48 @@ RealType UpstreamLongitudinalAssignmentConfidence(
  */
 RealType ComputeAssignmentConfidence(const CorridorRelatedFeatures& features);
 
+// /////////////////////////////////////////////////////////////////////////////
+// Fused confidence triples
+// /////////////////////////////////////////////////////////////////////////////
+
+//! Lateral assignment confidences of one (object, corridor) pair. For
+//! objects narrower than the corridor the three values partition the
+//! probability mass and sum to one (up to the far-field truncation of the
+//! side integrals); for wider objects the side ramps overlap the inside
+//! ramps and the sum exceeds one, as with the individual functions.
+struct LateralConfidenceTriple {
+  RealType right_of;  //!< besides the right boundary
+  RealType inside;    //!< within the lateral bounds
+  RealType left_of;   //!< besides the left boundary
+};
+
+//! Longitudinal assignment confidences of one (object, corridor) pair
+struct LongitudinalConfidenceTriple {
+  RealType upstream;    //!< before the corridor start
+  RealType inside;      //!< within the longitudinal bounds
+  RealType downstream;  //!< behind the corridor end
+};
+
+/**
+ * @brief Fused evaluation of the complete lateral triple (right-of, inside,
+ * left-of) in one pass. The separate confidence functions each evaluate the
+ * Gaussian cdf/pdf at integral bounds the other two touch as well; the fused
+ * version evaluates every bound once and assembles all integrals from the
+ * shared evaluations, roughly halving the erf/exp work per pair. Values are
+ * identical to the individual functions.
+ */
+LateralConfidenceTriple LateralAssignmentConfidences(
+    const CorridorRelatedFeatures& features);
+
+/**
+ * @brief Fused evaluation of the longitudinal triple (upstream, inside,
+ * downstream), sharing the Gaussian bound evaluations as in
+ * LateralAssignmentConfidences. Values are identical to the individual
+ * functions.
+ */
+LongitudinalConfidenceTriple LongitudinalAssignmentConfidences(
+    const CorridorRelatedFeatures& features);
+
 // /////////////////////////////////////////////////////////////////////////////
 // Moving Confidences
 // /////////////////////////////////////////////////////////////////////////////
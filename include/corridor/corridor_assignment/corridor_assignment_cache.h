@@ -0,0 +1,80 @@
+#pragma once
+
+#include <map>
+#include <utility>
+
+#include "corridor/basic_types.h"
+#include "corridor/cartesian_types.h"
+#include "corridor/corridor.h"
+#include "corridor/corridor_assignment/corridor_assignment.h"
+#include "corridor/frenet_types.h"
+#include "corridor/internal/oriented_bounding_box.h"
+
+namespace corridor {
+
+/**
+ * @brief Temporal cache of per-(track, corridor) assignment features.
+ *
+ * Tracked objects move only slightly between cycles while corridors are
+ * static, so recomputing CorridorRelatedFeatures from scratch every cycle
+ * wastes most of its cost on the Frenet projection and boundary lookups.
+ * The cache stores the last features per (track id, corridor id) pair:
+ * the next projection is warm-started with the cached base arc-length
+ * (composing with the hint-based candidate selection of the spline), the
+ * static corridor length is always reused, and the boundary-dependent
+ * width and center offset are only refreshed when the base arc-length
+ * moved more than a threshold since they were computed.
+ *
+ * The cache holds no corridor ownership; entries of dropped tracks should
+ * be released with forgetTrack().
+ */
+class CorridorAssignmentCache {
+ public:
+  /**
+   * @param arc_length_threshold: maximal base arc-length movement [m] up to
+   * which the cached corridor width and center offset are reused
+   */
+  explicit CorridorAssignmentCache(const RealType arc_length_threshold = 0.5)
+      : arc_length_threshold_(arc_length_threshold) {}
+
+  /**
+   * @brief Features of one (track, corridor) pair, warm-started from the
+   * previous cycle if an entry exists. Semantics match
+   * ComputeCorridorRelatedObjectFeature; the returned reference stays valid
+   * until the next call for the same pair or an eviction.
+   */
+  const CorridorRelatedFeatures& computeFeatures(
+      const IdType track_id, const CartesianState2D& cartesian_state,
+      const OrientedBoundingBox& oriented_bounding_box,
+      const Corridor& corridor);
+
+  /**
+   * @brief Assignment confidence of one (track, corridor) pair, based on the
+   * (warm-started) cached features.
+   */
+  RealType computeConfidence(const IdType track_id,
+                             const CartesianState2D& cartesian_state,
+                             const OrientedBoundingBox& oriented_bounding_box,
+                             const Corridor& corridor);
+
+  //! Drops all entries of one track, e.g. after track loss
+  void forgetTrack(const IdType track_id);
+
+  //! Drops all entries, e.g. after a corridor map update
+  void clear() { entries_.clear(); }
+
+  std::size_t size() const noexcept { return entries_.size(); }
+
+ private:
+  struct CacheEntry {
+    CorridorRelatedFeatures features;
+    //! Base arc-length at which width and center offset were last refreshed
+    RealType boundary_arc_length = 0.0;
+  };
+  using CacheKey = std::pair<IdType, IdType>;  //!< (track id, corridor id)
+
+  RealType arc_length_threshold_;
+  std::map<CacheKey, CacheEntry> entries_;
+};
+
+}  // namespace corridor
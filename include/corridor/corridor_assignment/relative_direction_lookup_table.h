@@ -0,0 +1,67 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <array>
+#include <cstddef>
+
+#include "corridor/basic_types.h"
+#include "corridor/corridor_assignment/corridor_related_semantics.h"
+
+namespace corridor {
+
+/**
+ * @brief Precomputed 2D lookup table for the semantic direction confidences
+ * (downstream, upstream, towards-left, towards-right).
+ *
+ * The exact confidences evaluate three Gaussian error integrals per label
+ * and object every cycle, although they are smooth in (relative heading,
+ * sigma) and the direction angles are fixed. The table samples all four
+ * labels once at construction on a regular (heading, sigma) grid and
+ * answers queries with bilinear interpolation; with the default resolution
+ * the interpolation error stays well below the 1e-3 classification
+ * tolerance.
+ *
+ * The sigma band enters the integrand nonlinearly and is therefore fixed
+ * per table; build one table per sigma band in use.
+ */
+class RelativeDirectionLookupTable {
+ public:
+  /**
+   * @param sigma_band: sigma band the table is built for
+   * @param num_heading_samples: grid resolution over heading in [-pi, pi]
+   * @param num_sigma_samples: grid resolution over sigma in [min_sigma,
+   * max_sigma]
+   * @param min_sigma / max_sigma: covered sigma range; queries outside are
+   * clamped to the border
+   */
+  explicit RelativeDirectionLookupTable(
+      const RealType sigma_band, const std::size_t num_heading_samples = 512,
+      const std::size_t num_sigma_samples = 256,
+      const RealType min_sigma = 1e-3, const RealType max_sigma = M_PI);
+
+  /**
+   * @brief Interpolated semantic label set, the fast-mode counterpart of
+   * RelativeDirectionConfidence. The heading is wrapped into [-pi, pi],
+   * sigma clamped into the covered range.
+   */
+  SemanticLabelSet labelSet(
+      const UncertainValue& relative_heading_angle) const;
+
+  RealType sigmaBand() const noexcept { return sigma_band_; }
+
+ private:
+  //! Bilinear interpolation in one label plane
+  RealType interpolate(const std::size_t label_idx, const RealType heading,
+                       const RealType sigma) const;
+
+  RealType sigma_band_;
+  RealType min_sigma_;
+  RealType max_sigma_;
+  RealType heading_step_;
+  RealType sigma_step_;
+  //! One confidence plane per label: rows over heading, columns over sigma
+  std::array<Eigen::Matrix<RealType, Eigen::Dynamic, Eigen::Dynamic>, 4>
+      planes_;
+};
+
+}  // namespace corridor
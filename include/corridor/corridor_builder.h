@@ -0,0 +1,48 @@
+#pragma once
+
+#include <vector>
+
+#include "corridor/cartesian_types.h"
+#include "corridor/corridor.h"
+
+namespace corridor {
+
+/**
+ * @brief Raw construction data of one corridor: everything needed to fit the
+ * reference line spline and convert both boundary polylines.
+ */
+struct CorridorConstructionData {
+  IdType id = InvalidId;
+  CartesianPoints2D reference_line_pts;
+  CartesianPoints2D left_boundary_pts;
+  CartesianPoints2D right_boundary_pts;
+};
+using CorridorConstructionDataVector = std::vector<CorridorConstructionData>;
+
+/**
+ * @brief Constructs one corridor with concurrent boundary conversion: the
+ *        left and right boundary projections are independent of each other,
+ *        so the left boundary is converted on a second thread while the
+ *        right boundary is converted on the calling thread.
+ *
+ * @param construction_data: reference line and boundary polylines
+ * @return CorridorPtr: constructed corridor
+ */
+CorridorPtr BuildCorridor(const CorridorConstructionData& construction_data);
+
+/**
+ * @brief Constructs a batch of corridors across a pool of worker threads,
+ *        e.g. when a new route is set and many corridors are created in a
+ *        burst. Corridors are independent of each other, so the batch scales
+ *        with the number of cores.
+ *
+ * @param construction_data: one entry per corridor
+ * @param num_threads: number of worker threads; 0 selects the hardware
+ * concurrency
+ * @return CorridorPtrs: constructed corridors, in input order
+ */
+CorridorPtrs BuildCorridors(
+    const CorridorConstructionDataVector& construction_data,
+    const std::size_t num_threads = 0);
+
+}  // namespace corridor
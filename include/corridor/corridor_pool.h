@@ -0,0 +1,72 @@
+#pragma once
+
+#include <deque>
+#include <utility>
+#include <vector>
+
+#include "corridor/corridor.h"
+
+namespace corridor {
+
+//! Lightweight non-owning handle to a pool-owned corridor. Valid as long as
+//! the owning CorridorPool is alive and not cleared.
+using CorridorHandle = const Corridor*;
+
+//! Path types over pool handles: copying them around during route
+//! enumeration is plain pointer copying, without refcount traffic
+using CorridorHandlePath = std::vector<CorridorHandle>;
+using CorridorHandlePaths = std::vector<CorridorHandlePath>;
+
+/**
+ * @brief Arena that owns corridor storage and hands out non-owning handles.
+ *
+ * Route enumeration copies corridor pointers into many short-lived paths;
+ * with shared_ptr every copy is an atomic refcount update and every corridor
+ * a separate heap object. The pool stores corridors in chunked contiguous
+ * blocks (std::deque, so growing never moves existing corridors) and paths
+ * carry raw handles, keeping ownership in one place.
+ */
+class CorridorPool {
+ public:
+  CorridorPool() = default;
+
+  // The pool owns its corridors; moving the container blocks is fine but
+  // copying the pool would silently duplicate all corridors
+  CorridorPool(const CorridorPool&) = delete;
+  CorridorPool& operator=(const CorridorPool&) = delete;
+  CorridorPool(CorridorPool&&) = default;
+  CorridorPool& operator=(CorridorPool&&) = default;
+
+  /**
+   * @brief Constructs a corridor in place in the pool.
+   *
+   * @param args: forwarded to one of the Corridor constructors
+   * @return CorridorHandle: handle to the pooled corridor, valid until
+   * clear() or pool destruction
+   */
+  template <typename... Args>
+  CorridorHandle construct(Args&&... args) {
+    corridors_.emplace_back(std::forward<Args>(args)...);
+    return &corridors_.back();
+  }
+
+  //! Moves an already constructed corridor into the pool
+  CorridorHandle add(Corridor&& corridor) {
+    corridors_.emplace_back(std::move(corridor));
+    return &corridors_.back();
+  }
+
+  //! Returns whether the pool holds any corridors
+  bool empty() const noexcept { return corridors_.empty(); }
+
+  //! Returns number of pooled corridors
+  std::size_t size() const noexcept { return corridors_.size(); }
+
+  //! Destroys all pooled corridors; all handles become invalid
+  void clear() { corridors_.clear(); }
+
+ private:
+  std::deque<Corridor> corridors_;
+};
+
+}  // namespace corridor
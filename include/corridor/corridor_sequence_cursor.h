@@ -0,0 +1,46 @@
+#pragma once
+
+#include "corridor/cartesian_types.h"
+#include "corridor/corridor.h"
+#include "corridor/frenet_types.h"
+
+namespace corridor {
+
+/**
+ * @brief Stateful cursor for projections of a tracked object onto a
+ *        CorridorSequence.
+ *
+ * An object moving along a route stays in the same corridor for many cycles.
+ * The cursor remembers the last matched corridor and the in-corridor
+ * arc-length, retries that corridor first (the arc-length is passed down as
+ * hint, composing with the warm-start spline projection) and only steps to
+ * neighboring corridors when the projection leaves the corridor — O(1) in
+ * steady state instead of a walk from the sequence front.
+ *
+ * The cursor holds a pointer to the sequence: it must not outlive it, and a
+ * mutated sequence requires a reset().
+ */
+class CorridorSequenceCursor {
+ public:
+  explicit CorridorSequenceCursor(const CorridorSequence* sequence)
+      : sequence_(sequence) {}
+
+  /**
+   * @brief Projects the position onto the sequence, starting at the last
+   * matched corridor. Result semantics match
+   * CorridorSequence::getFrenetPositionWithFrame: the position is relative
+   * to the matched corridor.
+   */
+  FrenetPositionWithFrame project(const CartesianPoint2D& position);
+
+  //! Forget the last match, e.g. after track loss or a sequence change
+  void reset() { last_match_valid_ = false; }
+
+ private:
+  const CorridorSequence* sequence_;
+  std::size_t corridor_index_ = 0;
+  RealType last_arc_length_ = 0.0;
+  bool last_match_valid_ = false;
+};
+
+}  // namespace corridor
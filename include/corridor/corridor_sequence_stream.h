@@ -0,0 +1,104 @@
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "corridor/corridor.h"
+
+namespace corridor {
+
+/**
+ * @brief Raw polylines of one route corridor before construction. The
+ * expensive part of corridor creation — the spline fit of the reference
+ * line and the Frenet projection of both boundaries — happens when a
+ * Corridor is built from these points.
+ */
+struct CorridorSource {
+  IdType id;
+  CartesianPoints2D reference_line;
+  CartesianPoints2D left_boundary;
+  CartesianPoints2D right_boundary;
+};
+using CorridorSources = std::vector<CorridorSource>;
+
+/**
+ * @brief Asynchronous prefetcher for route following.
+ *
+ * When following a planned route, corridors enter the active sequence as
+ * the ego advances; constructing one on demand causes a same-cycle latency
+ * spike in the control loop. The stream constructs upcoming corridors on a
+ * background thread a configurable lookahead distance ahead of the ego and
+ * splices the finished ones into its CorridorSequence on the next update()
+ * call, so construction cost never appears on the calling thread.
+ *
+ * Threading contract: update(), sequence() and the returned sequence are
+ * owned by the calling (control-loop) thread; only corridor construction
+ * happens on the background thread. update() never blocks on construction —
+ * it splices whatever is ready and advances the prefetch horizon.
+ */
+class CorridorSequenceStream {
+ public:
+  /**
+   * @param sources: polylines of the route corridors, in route order
+   * @param lookahead_distance: how far beyond the ego progress corridors
+   * are constructed in advance [m]
+   */
+  explicit CorridorSequenceStream(CorridorSources sources,
+                                  const RealType lookahead_distance = 200.0);
+  ~CorridorSequenceStream();
+
+  CorridorSequenceStream(const CorridorSequenceStream&) = delete;
+  CorridorSequenceStream& operator=(const CorridorSequenceStream&) = delete;
+
+  /**
+   * @brief Advances the prefetch horizon to ego_arc_length plus the
+   * lookahead distance and splices all corridors the prefetcher has
+   * finished into the active sequence. Non-blocking: call once per control
+   * cycle with the ego progress along the route.
+   *
+   * @param ego_arc_length: ego progress from the start of the route [m]
+   * @return the active sequence, extended by the spliced corridors
+   */
+  const CorridorSequence& update(const RealType ego_arc_length);
+
+  //! The active sequence as of the last update()
+  const CorridorSequence& sequence() const noexcept { return sequence_; }
+
+  //! Number of corridors constructed so far (spliced or awaiting splice)
+  std::size_t numConstructed() const;
+
+  //! True when every route source has been constructed
+  bool exhausted() const;
+
+  /**
+   * @brief Blocks until the prefetcher has constructed all corridors within
+   * the current horizon (or ran out of sources), e.g. at startup before the
+   * first control cycle or in tests. Call update() afterwards to splice.
+   */
+  void waitForHorizon() const;
+
+ private:
+  void prefetchLoop();
+
+  CorridorSources sources_;
+  const RealType lookahead_distance_;
+
+  // Touched only by the calling thread
+  CorridorSequence sequence_;
+
+  // Shared state below, guarded by mutex_
+  mutable std::mutex mutex_;
+  std::condition_variable work_available_;
+  mutable std::condition_variable construction_done_;
+  std::vector<CorridorPtr> ready_corridors_;  //< constructed, not yet spliced
+  std::size_t next_source_idx_ = 0;
+  RealType constructed_length_ = 0.0;  //< route length constructed so far
+  RealType horizon_;                   //< construct up to this arc-length
+  bool stop_ = false;
+
+  std::thread prefetch_thread_;
+};
+
+}  // namespace corridor
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+#include "corridor/corridor.h"
+
+namespace corridor {
+
+/**
+ * @brief Writes corridors into a flat binary file.
+ *
+ * The format stores each corridor as its already fitted parts: the spline
+ * data matrix of the reference line and the (l,d) data matrices of both
+ * boundary polylines, all as raw column-major values. Loading such a file
+ * therefore needs no spline fitting and no boundary conversion.
+ *
+ * @param corridors: corridors to serialize
+ * @param filename: target file, overwritten if it exists
+ * @return true - all corridors were written
+ * @return false - the file could not be written
+ */
+bool WriteCorridorsToBinaryFile(const CorridorPtrs& corridors,
+                                const std::string& filename);
+
+/**
+ * @brief Loads corridors written by WriteCorridorsToBinaryFile.
+ *
+ * The file is memory-mapped and the data matrices are adopted directly from
+ * the mapping without any parsing; only the derived spline coefficients and
+ * lookup indices are rebuilt.
+ *
+ * @param filename: file written by WriteCorridorsToBinaryFile
+ * @return CorridorPtrs: loaded corridors; empty if the file is missing or
+ * corrupted
+ */
+CorridorPtrs LoadCorridorsFromBinaryFile(const std::string& filename);
+
+}  // namespace corridor
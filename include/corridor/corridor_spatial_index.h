@@ -0,0 +1,83 @@
+#pragma once
+
+#include <vector>
+
+#include "corridor/cartesian_types.h"
+#include "corridor/corridor.h"
+
+namespace corridor {
+
+/**
+ * @brief Spatial index over corridor bounding boxes: a uniform grid where
+ *        each cell lists the corridors whose axis-aligned bounding box
+ *        intersects it. A point query touches one cell plus a bounding box
+ *        check per listed corridor, so testing an object against a map tile
+ *        costs O(overlapping corridors) instead of one projection per
+ *        corridor.
+ *
+ * The bounding boxes are derived from the sampled boundary polylines and
+ * padded by a configurable margin against the sampling discretization.
+ */
+class CorridorSpatialIndex {
+ public:
+  CorridorSpatialIndex() = default;
+  explicit CorridorSpatialIndex(const CorridorPtrs& corridors,
+                                const RealType cell_size = 10.0,
+                                const RealType margin = 0.5) {
+    build(corridors, cell_size, margin);
+  }
+
+  /**
+   * @brief (Re-)builds the index for the given corridors.
+   *
+   * @param corridors: indexed corridors, kept alive via shared pointers
+   * @param cell_size: edge length of one grid cell [m]
+   * @param margin: padding added around each bounding box [m]
+   */
+  void build(const CorridorPtrs& corridors, const RealType cell_size = 10.0,
+             const RealType margin = 0.5);
+
+  //! Removes all corridors from the index
+  void clear() {
+    corridors_.clear();
+    bounding_boxes_.clear();
+    cells_.clear();
+  }
+
+  //! Returns whether the index holds any corridors
+  bool empty() const noexcept { return corridors_.empty(); }
+
+  //! Returns number of indexed corridors
+  std::size_t size() const noexcept { return corridors_.size(); }
+
+  /**
+   * @brief Returns all corridors whose (padded) bounding box contains the
+   * point. The exact deviation check against the returned candidates remains
+   * with the caller.
+   */
+  CorridorPtrs corridorCandidatesAt(const CartesianPoint2D& point) const;
+
+ private:
+  //! Axis-aligned bounding box of one corridor, padded by the build margin
+  struct BoundingBox {
+    RealType min_x, min_y, max_x, max_y;
+    bool contains(const CartesianPoint2D& point) const noexcept {
+      return min_x <= point.x() && point.x() <= max_x &&  //
+             min_y <= point.y() && point.y() <= max_y;
+    }
+  };
+
+  CorridorPtrs corridors_;
+  std::vector<BoundingBox> bounding_boxes_;
+
+  // Uniform grid over the union of all bounding boxes; each cell lists the
+  // indices of the corridors intersecting it
+  std::vector<std::vector<std::size_t>> cells_;
+  RealType origin_x_ = 0.0;
+  RealType origin_y_ = 0.0;
+  RealType inv_cell_size_ = 0.0;
+  std::size_t num_cells_x_ = 0;
+  std::size_t num_cells_y_ = 0;
+};
+
+}  // namespace corridor
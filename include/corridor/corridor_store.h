@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "corridor/corridor.h"
+#include "corridor/corridor_pool.h"
+
+namespace corridor {
+
+/**
+ * @brief Immutable set of corridors published as one unit.
+ *
+ * A snapshot is frozen at construction: all query methods are const and the
+ * corridors are only reachable through const handles, so any number of
+ * threads may read one snapshot concurrently without synchronization.
+ * Corridors are stored in a deque (like CorridorPool), so handles are plain
+ * pointers into snapshot-owned storage — iterating and copying them causes
+ * no refcount traffic.
+ */
+class CorridorSnapshot {
+ public:
+  CorridorSnapshot(std::deque<Corridor>&& corridors, const std::uint64_t epoch)
+      : corridors_(std::move(corridors)), epoch_(epoch) {
+    handles_.reserve(corridors_.size());
+    for (const Corridor& corridor : corridors_) {
+      handles_.push_back(&corridor);
+      by_id_.emplace(corridor.id(), &corridor);
+    }
+  }
+
+  CorridorSnapshot(const CorridorSnapshot&) = delete;
+  CorridorSnapshot& operator=(const CorridorSnapshot&) = delete;
+
+  //! Monotonically increasing publication counter of the owning store
+  std::uint64_t epoch() const noexcept { return epoch_; }
+
+  bool empty() const noexcept { return handles_.empty(); }
+  std::size_t size() const noexcept { return handles_.size(); }
+
+  //! Handle to the idx-th corridor; valid as long as the snapshot is alive
+  CorridorHandle at(const std::size_t idx) const { return handles_[idx]; }
+
+  //! All corridor handles of the snapshot, e.g. for range-based iteration
+  const std::vector<CorridorHandle>& handles() const noexcept {
+    return handles_;
+  }
+
+  //! Handle to the corridor with the given id, nullptr if not present
+  CorridorHandle findById(const IdType id) const {
+    const auto iter = by_id_.find(id);
+    return (iter != by_id_.end()) ? iter->second : nullptr;
+  }
+
+ private:
+  std::deque<Corridor> corridors_;
+  std::vector<CorridorHandle> handles_;
+  std::map<IdType, CorridorHandle> by_id_;
+  std::uint64_t epoch_;
+};
+using CorridorSnapshotPtr = std::shared_ptr<const CorridorSnapshot>;
+
+/**
+ * @brief Publication point between one map updater and many reader threads.
+ *
+ * Readers call snapshot() once per processing cycle — a single atomic
+ * shared_ptr load — and then work with plain corridor handles into the
+ * snapshot for the rest of the cycle, so per-corridor access causes no
+ * control-block contention. The updater assembles the next corridor set and
+ * swaps it in with publish(); readers still holding the previous snapshot
+ * keep it alive, and it is reclaimed automatically when the last of them
+ * drops its reference (epoch-style reclamation through shared ownership).
+ */
+class CorridorStore {
+ public:
+  CorridorStore()
+      : current_(std::make_shared<const CorridorSnapshot>(
+            std::deque<Corridor>(), 0)) {}
+
+  CorridorStore(const CorridorStore&) = delete;
+  CorridorStore& operator=(const CorridorStore&) = delete;
+
+  //! The currently published snapshot; never nullptr. Hold the returned
+  //! pointer for the duration of one processing cycle and query through it.
+  CorridorSnapshotPtr snapshot() const {
+    return std::atomic_load_explicit(&current_, std::memory_order_acquire);
+  }
+
+  //! Epoch of the currently published snapshot
+  std::uint64_t epoch() const { return snapshot()->epoch(); }
+
+  /**
+   * @brief Publishes a new corridor set, replacing the current snapshot for
+   * all future snapshot() calls. Thread-safe against readers; concurrent
+   * publishers are serialized only by the atomic swap, last one wins.
+   *
+   * @param corridors: the new corridor set, handed over by value
+   * @return epoch assigned to the published snapshot
+   */
+  std::uint64_t publish(std::deque<Corridor>&& corridors) {
+    const std::uint64_t epoch =
+        next_epoch_.fetch_add(1, std::memory_order_relaxed);
+    CorridorSnapshotPtr snapshot = std::make_shared<const CorridorSnapshot>(
+        std::move(corridors), epoch);
+    std::atomic_store_explicit(&current_, std::move(snapshot),
+                               std::memory_order_release);
+    return epoch;
+  }
+
+ private:
+  CorridorSnapshotPtr current_;
+  std::atomic<std::uint64_t> next_epoch_{1};
+};
+
+}  // namespace corridor
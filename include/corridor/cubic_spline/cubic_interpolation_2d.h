@@ -37,6 +37,19 @@ DataMatrix<RealType> NaturalSplineDataMatrixFromPoints(
     const CartesianPoints2D& cartesian_points,
     const RealType epsilon = g_epsilon_arc_length);
 
+/**
+ * @brief Zero-copy overload: fits the natural spline directly from a
+ *        non-owning view on externally held points (e.g. contiguous map-layer
+ *        buffers), without materializing a point vector first.
+ *
+ * @param cartesian_points: view on the support points, one point per column
+ * @param epsilon: allowed error of the spline length approximation
+ * @return DataMatrix<RealType>
+ */
+DataMatrix<RealType> NaturalSplineDataMatrixFromPoints(
+    const CartesianPointsView2D& cartesian_points,
+    const RealType epsilon = g_epsilon_arc_length);
+
 /**
  * @brief Creates a spline data matrix a polyline, where the tangen in the first
  *        and last point is predefined.
@@ -53,5 +66,23 @@ DataMatrix<RealType> ClampedSplineDataMatrixFromPoints(
     const CartesianVector2D& last_tangent,
     const RealType epsilon = g_epsilon_arc_length);
 
+/**
+ * @brief Extends an already fitted spline data matrix by additional points at
+ *        the end. Instead of re-solving the full moment system, only a
+ *        trailing window of nodes is refitted: appending a point perturbs the
+ *        moments of earlier nodes with exponentially decaying magnitude, so
+ *        pinning the moment at the window start reproduces the full refit up
+ *        to a negligible residual. The cost per call is O(window + appended
+ *        points) independent of the spline length.
+ *
+ * @param data: fitted spline data matrix (at least two nodes)
+ * @param new_points: Cartesian points appended behind the last node
+ * @param epsilon: allowed error of the spline length approximation
+ * @return DataMatrix<RealType>: extended data matrix
+ */
+DataMatrix<RealType> AppendToSplineDataMatrix(
+    const DataMatrix<RealType>& data, const CartesianPoints2D& new_points,
+    const RealType epsilon = g_epsilon_arc_length);
+
 }  // namespace cubic_spline
 }  // namespace corridor
@@ -8,8 +8,10 @@
 
 #include "corridor/basic_types.h"
 #include "corridor/cartesian_types.h"
+#include "corridor/cubic_spline/cubic_spline_coefficients.h"
 #include "corridor/cubic_spline/cubic_spline_types.h"
 #include "corridor/frenet_types.h"
+#include "corridor/internal/arc_length_index.h"
 
 namespace corridor {
 namespace cubic_spline {
@@ -20,6 +22,21 @@ class CubicSpline {
               const RealType epsilon = g_epsilon_arc_length)
       : id_(id), epsilon_(epsilon) {}
   CubicSpline(const IdType id, const CartesianPoints2D& points,
+              const RealType epsilon = g_epsilon_arc_length,
+              const bool decimate_points = false)
+      : id_(id), epsilon_(epsilon) {
+    bool result = constructSplineData(points, decimate_points);
+    if (result == false) {
+      // If spline data is corrupted, id is changed to invalid
+      id_ = InvalidId;
+    }
+  }
+  /**
+   * @brief Zero-copy construction from a non-owning view on externally held
+   *        points (e.g. contiguous map-layer buffers); the points enter the
+   *        data matrix as one block copy instead of via a point vector.
+   */
+  CubicSpline(const IdType id, const CartesianPointsView2D& points,
               const RealType epsilon = g_epsilon_arc_length)
       : id_(id), epsilon_(epsilon) {
     bool result = constructSplineData(points);
@@ -38,12 +55,29 @@ class CubicSpline {
       id_ = InvalidId;
     }
   }
+  /**
+   * @brief Reconstructs a spline from an already fitted data matrix, e.g.
+   *        when loading serialized corridors. No spline fitting is
+   *        performed, only the derived coefficients and lookup index are
+   *        rebuilt.
+   */
+  CubicSpline(const IdType id, const DataMatrix<RealType>& data,
+              const RealType epsilon = g_epsilon_arc_length)
+      : id_(id), epsilon_(epsilon) {
+    bool result = constructSplineData(data);
+    if (result == false) {
+      // If spline data is corrupted, id is changed to invalid
+      id_ = InvalidId;
+    }
+  }
   CubicSpline(const IdType id, const CartesianPoints2D& points,
               const CartesianVector2D& first_tangent,
               const CartesianVector2D& last_tangent,
-              const RealType epsilon = g_epsilon_arc_length)
+              const RealType epsilon = g_epsilon_arc_length,
+              const bool decimate_points = false)
       : id_(id), epsilon_(epsilon) {
-    bool result = constructSplineData(points, first_tangent, last_tangent);
+    bool result = constructSplineData(points, first_tangent, last_tangent,
+                                      decimate_points);
     if (result == false) {
       // If spline data is corrupted, id is changed to invalid
       id_ = InvalidId;
@@ -53,7 +87,9 @@ class CubicSpline {
   /** @name Simple public get functions */
   ///@{
   inline IdType GetId() const { return id_; }
+  inline RealType GetEpsilon() const { return epsilon_; }
   inline DataSize GetSize() const { return data_.cols(); }
+  inline const DataMatrix<RealType>& GetData() const { return data_; }
   inline RealType GetTotalLength() const {
     return (data_.cols() == 0) ? (0.0) : (data_.rightCols<1>()(kArcLength));
   }
@@ -65,6 +101,29 @@ class CubicSpline {
   }
   ///@}
 
+  /**
+   * @brief Extends the spline by additional points behind its current end.
+   *        Only a trailing window of the moment system is re-solved, so a
+   *        rolling reference line costs O(appended points) per cycle instead
+   *        of a full refit.
+   *
+   * @param points: Cartesian points appended behind the last node
+   * @return true - spline was extended (or constructed, if it was empty)
+   * @return false - extension was not possible
+   */
+  bool append(const CartesianPoints2D& points);
+
+  /**
+   * @brief Drops the first n nodes of the spline and shifts the arc-lengths
+   *        so that the new first node starts at zero. The remaining segments
+   *        keep their exact shape; no moment system is re-solved.
+   *
+   * @param n: number of nodes to drop from the front
+   * @return true - nodes were dropped
+   * @return false - dropping n nodes would not leave a valid spline
+   */
+  bool popFront(const DataSize n);
+
   /**
    * @brief FrenetFrames constructs all frenet frames for the perpendicular
    *        projection of point onto the spline
@@ -81,12 +140,62 @@ class CubicSpline {
 
   FrenetPolyline toFrenetPolyline(const CartesianPoints2D& points) const;
 
+  /**
+   * @brief Batched projection of a whole point set onto the spline. The
+   *        node-tangent projections of all points are evaluated as one
+   *        matrix product and the roots are resolved segment by segment.
+   *
+   * @param points: matrix with one Cartesian point per column; Eigen::Ref
+   * binds owning matrices and non-owning views without a copy
+   * @return FrenetPolyline
+   */
+  FrenetPolyline projectPoints(
+      const Eigen::Ref<const Eigen::Matrix<RealType, 2, Eigen::Dynamic>>&
+          points) const;
+
+  /**
+   * @brief Batch conversion of Frenet points (relative to this spline) back
+   *        to Cartesian coordinates, the mirror image of projectPoints. The
+   *        queries are bucketed by segment and each segment's polynomial is
+   *        evaluated once over all of its queries as a single Eigen
+   *        expression, instead of one segment lookup and frame interpolation
+   *        per point.
+   *
+   * @param frenet_points: Frenet points, in arbitrary order
+   * @param cartesian_points: caller-provided buffer, one point per column in
+   * the order of the input. Only reallocated if the number of points changed.
+   * @return DataSize: number of points written
+   */
+  DataSize toCartesianPolyline(
+      const FrenetPoints2D& frenet_points,
+      Eigen::Matrix<RealType, 2, Eigen::Dynamic>* cartesian_points) const;
+
   void fillCartesianPolyline(CartesianPoints2D* polyline,
                              const RealType delta_l = -1.0) const;
 
+  /**
+   * @brief Batch sampling of the spline at equidistant arc-lengths. Walks
+   *        the segments once in order and evaluates all queries of a segment
+   *        with a single Eigen expression, instead of one segment lookup and
+   *        coefficient evaluation per point.
+   *
+   * @param delta_l: sampling distance along the reference line [m]
+   * @param positions: caller-provided buffer, one sample per column. Only
+   * reallocated if the number of samples changed.
+   * @param normals: optional caller-provided buffer for the normal vectors
+   * @return DataSize: number of samples written
+   */
+  DataSize sampleCartesianPolyline(
+      const RealType delta_l,
+      Eigen::Matrix<RealType, 2, Eigen::Dynamic>* positions,
+      Eigen::Matrix<RealType, 2, Eigen::Dynamic>* normals = nullptr) const;
+
   // Introspection
   friend std::ostream& operator<<(std::ostream& os, const CubicSpline& cs);
 
+  // Warm-start projector needs direct access to data and coefficients
+  friend class SplineProjector;
+
  private:
   /**
    * @brief Constructs the spline data matrix from a list of points
@@ -103,22 +212,47 @@ class CubicSpline {
    * @brief  Constructs the spline data matrix from a polyline
    *
    * @param points
+   * @param decimate_points: decimate oversampled polylines (bounded by
+   * epsilon_) before fitting
+   * @return true
+   * @return false
+   */
+  bool constructSplineData(const CartesianPoints2D& points,
+                           const bool decimate_points = false);
+
+  /**
+   * @brief Constructs the spline data matrix from a non-owning point view
+   *
+   * @param points
    * @return true
    * @return false
    */
-  bool constructSplineData(const CartesianPoints2D& points);
+  bool constructSplineData(const CartesianPointsView2D& points);
 
   /**
    * @brief  Constructs the spline data matrix from a polyline with tangent
    * vectors for the first and last point
    *
    * @param points
+   * @param decimate_points: decimate oversampled polylines (bounded by
+   * epsilon_) before fitting
    * @return true
    * @return false
    */
   bool constructSplineData(const CartesianPoints2D& points,
                            const CartesianVector2D& first_tangent,
-                           const CartesianVector2D& last_tangent);
+                           const CartesianVector2D& last_tangent,
+                           const bool decimate_points = false);
+
+  /**
+   * @brief Adopts an already fitted data matrix and rebuilds the derived
+   * coefficients and arc-length index
+   *
+   * @param data
+   * @return true
+   * @return false
+   */
+  bool constructSplineData(const DataMatrix<RealType>& data);
 
   /**
    * @brief Get the Segment Index At Arc Length object
@@ -140,19 +274,24 @@ class CubicSpline {
   IdType id_;                  ///< Unique id of the spline
   RealType epsilon_;           ///< Approximation epsilon of spline fitting
   DataMatrix<RealType> data_;  ///< Data matrix of all sample points information
+  SplineCoefficients2d coefficients_;  ///< Segment coefficients, derived once
+                                       ///< from data_ at construction
+  ArcLengthIndex arc_length_index_;    ///< O(1) arc-length to segment lookup
 };                             // namespace cubic_spline
 
 inline std::ostream& operator<<(std::ostream& os, const CubicSpline& cs) {
   using namespace std;
   os << "CubicSpline: " << cs.id_ << " \n";
-  os << "IDX\tPT_X\tPT_Y\tM_X\t\tM_Y\t\tARCLEN\n";
+  os << "IDX\tPT_X\tPT_Y\tM_X\t\tM_Y\t\tARCLEN\tTAN_X\tTAN_Y\n";
   for (int idx = 0; idx < cs.data_.cols(); idx++) {
     os << idx << "\t";
     os << left << setw(8) << setfill(' ') << cs.data_(kPoint_x, idx) << "\t";
     os << left << setw(8) << setfill(' ') << cs.data_(kPoint_y, idx) << "\t";
     os << left << setw(8) << setfill(' ') << cs.data_(kMoment_x, idx) << "\t";
     os << left << setw(8) << setfill(' ') << cs.data_(kMoment_y, idx) << "\t";
-    os << left << setw(8) << setfill(' ') << cs.data_(kArcLength, idx) << "\n";
+    os << left << setw(8) << setfill(' ') << cs.data_(kArcLength, idx) << "\t";
+    os << left << setw(8) << setfill(' ') << cs.data_(kTangent_x, idx) << "\t";
+    os << left << setw(8) << setfill(' ') << cs.data_(kTangent_y, idx) << "\n";
   }
   return os;
 }
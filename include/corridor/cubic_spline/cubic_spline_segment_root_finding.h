@@ -1,5 +1,7 @@
 #pragma once
 
+#include <Eigen/Eigenvalues>
+#include <array>
 #include <utility>
 
 #include "corridor/basic_types.h"
@@ -105,6 +107,101 @@ std::pair<bool, RealType> NewtonRaphsonMethod(const Coefficients2d& coeffs,
   return std::make_pair(false, l_curr);
 }
 
+/**
+ * @brief Computes the perpendicular projection directly as the real roots of
+ *        the projection polynomial f(l) = t(l) . (point - position(l)),
+ *        which has degree 5 on a cubic segment, via the eigenvalues of its
+ *        companion matrix. The operation count is bounded and branch-light:
+ *        worst-case latency is fixed by one small eigenvalue decomposition
+ *        instead of up to ~100 data-dependent Brent iterations. Among
+ *        multiple real roots inside the segment, the one closest to the
+ *        point is returned.
+ *
+ * @param coeffs
+ * @param arc_length
+ * @param point
+ * @param epsilon
+ * @return std::pair<bool, RealType>: false if no real root lies within the
+ * segment limits; the caller should then fall back to BrentsMethod
+ */
+std::pair<bool, RealType> PolynomialRootsMethod(const Coefficients2d& coeffs,
+                                                const RealType arc_length,
+                                                const CartesianPoint2D& point,
+                                                const RealType epsilon = 1e-3) {
+  const RealType e_x = point.x() - coeffs.a_x;
+  const RealType e_y = point.y() - coeffs.a_y;
+
+  // f(l) = t(l) . (point - position(l)), expanded in powers of l
+  std::array<RealType, 6> poly;
+  poly[0] = coeffs.b_x * e_x + coeffs.b_y * e_y;
+  poly[1] = 2.0 * (coeffs.c_x * e_x + coeffs.c_y * e_y) -
+            (coeffs.b_x * coeffs.b_x + coeffs.b_y * coeffs.b_y);
+  poly[2] = 3.0 * (coeffs.d_x * e_x + coeffs.d_y * e_y) -
+            3.0 * (coeffs.b_x * coeffs.c_x + coeffs.b_y * coeffs.c_y);
+  poly[3] = -4.0 * (coeffs.b_x * coeffs.d_x + coeffs.b_y * coeffs.d_y) -
+            2.0 * (coeffs.c_x * coeffs.c_x + coeffs.c_y * coeffs.c_y);
+  poly[4] = -5.0 * (coeffs.c_x * coeffs.d_x + coeffs.c_y * coeffs.d_y);
+  poly[5] = -3.0 * (coeffs.d_x * coeffs.d_x + coeffs.d_y * coeffs.d_y);
+
+  // Trim vanishing leading coefficients: straight or nearly straight
+  // segments reduce the polynomial degree
+  RealType max_coefficient = 0.0;
+  for (const RealType coefficient : poly) {
+    max_coefficient = std::max(max_coefficient, std::abs(coefficient));
+  }
+  if (max_coefficient == 0.0) {
+    return std::make_pair(false, 0.0);
+  }
+  int degree = 5;
+  while (1 < degree && std::abs(poly[degree]) < 1e-12 * max_coefficient) {
+    degree--;
+  }
+
+  // Keep the real root inside the segment limits which is closest to the
+  // point
+  bool root_found = false;
+  RealType best_root = 0.0;
+  RealType best_squared_distance = std::numeric_limits<RealType>::max();
+  const auto consider_root = [&](const RealType root_candidate) {
+    if (root_candidate < -epsilon ||
+        coeffs.max_length + epsilon < root_candidate) {
+      return;
+    }
+    const RealType root =
+        limit(root_candidate, RealType(0.0), coeffs.max_length);
+    const RealType squared_distance =
+        (point - coeffs.interpolatePosition(root)).squaredNorm();
+    if (squared_distance < best_squared_distance) {
+      best_squared_distance = squared_distance;
+      best_root = root;
+      root_found = true;
+    }
+  };
+
+  if (degree == 1) {
+    if (poly[1] != 0.0) {
+      consider_root(-poly[0] / poly[1]);
+    }
+  } else {
+    Eigen::MatrixXd companion = Eigen::MatrixXd::Zero(degree, degree);
+    for (int i = 1; i < degree; i++) {
+      companion(i, i - 1) = 1.0;
+    }
+    for (int i = 0; i < degree; i++) {
+      companion(i, degree - 1) = -poly[i] / poly[degree];
+    }
+    const Eigen::EigenSolver<Eigen::MatrixXd> solver(companion, false);
+    const auto& eigenvalues = solver.eigenvalues();
+    for (int i = 0; i < eigenvalues.size(); i++) {
+      if (std::abs(eigenvalues(i).imag()) <
+          1e-8 * (1.0 + std::abs(eigenvalues(i).real()))) {
+        consider_root(eigenvalues(i).real());
+      }
+    }
+  }
+  return std::make_pair(root_found, best_root);
+}
+
 /**
  * @brief
  *
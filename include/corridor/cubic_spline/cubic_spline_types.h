@@ -12,6 +12,14 @@ namespace cubic_spline {
 constexpr double g_epsilon_projection = 1e-3;
 constexpr double g_epsilon_arc_length = 1e-5;
 
+/**
+ * Root-finding strategy for the perpendicular projection onto a segment.
+ * kBrent: iterative bracketing, data-dependent iteration count (default).
+ * kPolynomial: direct companion-matrix roots of the projection polynomial
+ * with bounded worst-case latency; falls back to Brent if no root is found.
+ */
+enum class ProjectionMethod : int8_t { kBrent = 0, kPolynomial };
+
 /** Data types of each data point (column) in the data matrix */
 enum BasicDataTypes : int8_t {
   kPoint_x = 0,  //!< Cartesian position in x direction [m]
@@ -19,13 +27,17 @@ enum BasicDataTypes : int8_t {
   kMoment_x,     //!< Inner moment of the spline in x direction [1/m]
   kMoment_y,     //!< Inner moment of the spline in y direction [1/m]
   kArcLength,    //!< Arc-length from start of spline to specific point [m]
+  kTangent_x,    //!< Normalized tangent of the spline in x direction [-]
+  kTangent_y,    //!< Normalized tangent of the spline in y direction [-]
   kSize
 };
 
 /**
  * Data Matrix which comprises all needed information of a cubic spline
  * Rows:    sample points  1,2,3,...,i,...,M (M = number of points)
- * Columns: one sample point m_i = [x_i, y_i, m_x_i, m_y_i, l_i, tl_i ]
+ * Columns: one sample point m_i = [x_i, y_i, m_x_i, m_y_i, l_i, t_x_i, t_y_i ]
+ * The tangents are fully determined by the points and moments, but are
+ * precomputed once at construction since every projection query needs them.
  */
 template <typename T>
 using DataMatrix = Eigen::Matrix<T, BasicDataTypes::kSize, Eigen::Dynamic>;
@@ -2,6 +2,8 @@
 
 #include <Eigen/Core>
 #include <chrono>
+#include <cstdint>
+#include <limits>
 #include <vector>
 
 #include "corridor/basic_types.h"
@@ -11,6 +13,35 @@
 namespace corridor {
 namespace cubic_spline {
 
+// /////////////////////////////////////////////////////////////////////////////
+// Projection error reporting
+// /////////////////////////////////////////////////////////////////////////////
+
+//! Failure codes of the projection hot path
+enum class ProjectionError : int {
+  //! Root finding failed on a segment candidate; the projection falls back
+  //! to the segment boundary value
+  kNoRootOnSegmentCandidate = 0,
+};
+
+//! Callback invoked on projection failures with the error code and the
+//! index of the affected segment. Must be cheap and thread-safe: the batch
+//! engines project from multiple worker threads.
+using ProjectionErrorCallback = void (*)(const ProjectionError error,
+                                         const DataIdx segment_idx);
+
+/**
+ * @brief Installs a process-wide callback for projection failures, e.g. to
+ * log them through the application's own channel. nullptr (the default)
+ * disables reporting, leaving only a relaxed atomic counter increment on
+ * the failure branch — the hot path never touches iostreams.
+ */
+void SetProjectionErrorCallback(const ProjectionErrorCallback callback);
+
+//! Number of projection failures since process start, counted also without
+//! an installed callback
+std::uint64_t ProjectionErrorCount();
+
 /**
  * @brief Evaluates the position at a given arc-length on the data segment
  *
@@ -78,6 +109,8 @@ RealType InterpolateSignedCurvatureValue(
  */
 using FrenetFrameTripod = std::tuple<CartesianPoint2D, CartesianPoint2D,
                                      CartesianPoint2D, RealType, RealType>;
+FrenetFrameTripod InterpolateFrenetFrameTripod(
+    const Coefficients2d& segment_coeffs, const RealType arc_length);
 FrenetFrameTripod InterpolateFrenetFrameTripod(
     const DataSegment<RealType>& data_segment, const RealType arc_length);
 
@@ -91,6 +124,20 @@ FrenetFrameTripod InterpolateFrenetFrameTripod(
 Eigen::Matrix<RealType, 2, Eigen::Dynamic> TangentsOnNodes(
     const DataMatrix<RealType>& data);
 
+/**
+ * @brief Decimates an oversampled polyline before spline fitting
+ *        (Douglas-Peucker). Points whose perpendicular distance to the chord
+ *        of their neighbors stays below epsilon are dropped, so straight
+ *        sections collapse to a handful of segments while curved sections
+ *        keep their density. First and last point are always kept.
+ *
+ * @param points: polyline to decimate
+ * @param epsilon: maximal allowed perpendicular deviation [m]
+ * @return CartesianPoints2D: decimated polyline
+ */
+CartesianPoints2D DecimatePoints(const CartesianPoints2D& points,
+                                 const RealType epsilon);
+
 /**
  * @brief Project a point to tangent at arc-length
  *
@@ -135,10 +182,39 @@ bool FindSegmentCandidates(
  * @return true
  * @return false
  */
-bool FindProjectionOnSegment(const DataSegment<RealType>& data_segment,
-                             SegmentInfo<DataIdx, RealType>* segment_info,
-                             const CartesianPoint2D& point,
-                             const RealType epsilon = g_epsilon_projection);
+/**
+ * @brief Resolves the perpendicular projection of a point starting from a
+ *        previous match (segment index plus relative arc-length in
+ *        segment_info). Walks at most a few segments from the warm start and
+ *        refines the root with a localized Newton-Raphson step instead of a
+ *        global segment search.
+ *
+ * @param data: spline data matrix
+ * @param coefficients: one Coefficients2d per spline segment
+ * @param point: which is projected on the spline
+ * @param segment_info: in: previous match, out: updated match
+ * @return true: if the projection was resolved near the warm start
+ * @return false: if the warm start diverged; the caller should fall back to
+ * the global search
+ */
+bool FindProjectionFromWarmStart(const DataMatrix<RealType>& data,
+                                 const SplineCoefficients2d& coefficients,
+                                 const CartesianPoint2D& point,
+                                 SegmentInfo<DataIdx, RealType>* segment_info,
+                                 const RealType epsilon = g_epsilon_projection);
+
+bool FindProjectionOnSegment(
+    const Coefficients2d& segment_coeffs,
+    SegmentInfo<DataIdx, RealType>* segment_info,
+    const CartesianPoint2D& point,
+    const RealType epsilon = g_epsilon_projection,
+    const ProjectionMethod method = ProjectionMethod::kBrent);
+bool FindProjectionOnSegment(
+    const DataSegment<RealType>& data_segment,
+    SegmentInfo<DataIdx, RealType>* segment_info,
+    const CartesianPoint2D& point,
+    const RealType epsilon = g_epsilon_projection,
+    const ProjectionMethod method = ProjectionMethod::kBrent);
 
 /**
  * @brief
@@ -147,6 +223,10 @@ bool FindProjectionOnSegment(const DataSegment<RealType>& data_segment,
  * @param segment_info
  * @return FrenetFrame2D
  */
+FrenetFrame2D ConstructFrenetFrame(const Coefficients2d& segment_coeffs,
+                                   const RealType segment_start_arc_length,
+                                   SegmentInfo<DataIdx, RealType> segment_info,
+                                   const IdType id = InvalidId);
 FrenetFrame2D ConstructFrenetFrame(const DataSegment<RealType>& data_segment,
                                    SegmentInfo<DataIdx, RealType> segment_info,
                                    const IdType id = InvalidId);
@@ -173,6 +253,52 @@ FrenetPositionsWithFrames ConstructFrenetPositionsWithFrames(
     const DataMatrix<RealType>& data, const CartesianPoint2D& point,
     const IdType id = InvalidId);
 
+/**
+ * @brief Same as above, but reuses the segment coefficients which are
+ *        precomputed at spline construction instead of rebuilding them from
+ *        the data matrix on every query.
+ *
+ * @param data
+ * @param coefficients: one Coefficients2d per spline segment
+ * @param point
+ * @param id
+ * @return FrenetPositionsWithFrames
+ */
+FrenetPositionsWithFrames ConstructFrenetPositionsWithFrames(
+    const DataMatrix<RealType>& data, const SplineCoefficients2d& coefficients,
+    const CartesianPoint2D& point, const IdType id = InvalidId);
+
+/**
+ * Capacity of the stack-side segment candidate buffer of the single-result
+ * projection query. Two to four candidates cover virtually all real
+ * corridors; only degenerate, circle-like reference lines exceed this.
+ */
+constexpr std::size_t kMaxSegmentCandidates = 8;
+
+/**
+ * @brief Allocation-free single-result projection query. Segment candidates
+ *        are collected in a fixed-capacity stack buffer and only the best
+ *        match (smallest absolute deviation, or closest to the arc-length
+ *        hint if one is given) is constructed into the out-parameter, so the
+ *        hot path performs no heap allocation.
+ *
+ * @param data: spline data matrix
+ * @param coefficients: one Coefficients2d per spline segment
+ * @param point: which is projected on the spline
+ * @param position_with_frame: out-parameter, only written on success
+ * @param id: id of the spline, stored in the frenet base
+ * @param arc_length_hint: optional expected arc-length of the match
+ * @return true: result was written
+ * @return false: more candidates than the buffer capacity (or an empty
+ * spline); the caller should fall back to the allocating variant
+ */
+bool ConstructFrenetPositionWithFrame(
+    const DataMatrix<RealType>& data, const SplineCoefficients2d& coefficients,
+    const CartesianPoint2D& point,
+    FrenetPositionWithFrame* position_with_frame, const IdType id = InvalidId,
+    const RealType arc_length_hint =
+        std::numeric_limits<RealType>::quiet_NaN());
+
 /**
  * @brief Converts list of x,y points to a FrenetPolyline
  *
@@ -184,5 +310,23 @@ FrenetPositionsWithFrames ConstructFrenetPositionsWithFrames(
 FrenetPolyline ConvertToFrenetPolyline(const DataMatrix<RealType>& data,
                                        const CartesianPoints2D& pts);
 
+/**
+ * @brief Batched conversion of a whole point set to a FrenetPolyline.
+ *
+ * The tangential projections of all points onto all node tangents are
+ * computed as one matrix product, so Eigen can vectorize across points
+ * instead of across a single 2-vector. The roots are then resolved segment
+ * by segment, reusing each segment's coefficients for all of its candidate
+ * points.
+ *
+ * @param data: spline data matrix
+ * @param coefficients: one Coefficients2d per spline segment
+ * @param points: matrix with one Cartesian point per column
+ * @return FrenetPolyline
+ */
+FrenetPolyline ConvertToFrenetPolyline(
+    const DataMatrix<RealType>& data, const SplineCoefficients2d& coefficients,
+    const Eigen::Ref<const Eigen::Matrix<RealType, 2, Eigen::Dynamic>>& points);
+
 }  // namespace cubic_spline
 }  // namespace corridor
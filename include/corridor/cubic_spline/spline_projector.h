@@ -0,0 +1,54 @@
+#pragma once
+
+#include "corridor/basic_types.h"
+#include "corridor/cartesian_types.h"
+#include "corridor/cubic_spline/cubic_spline.h"
+#include "corridor/frenet_types.h"
+
+namespace corridor {
+namespace cubic_spline {
+
+/**
+ * @brief Persistent projector for tracked objects.
+ *
+ * Holds the last matched segment index and relative arc-length and resolves
+ * the next projection with a localized Newton-Raphson step around the warm
+ * start. Consecutive projections of a tracked object move by fractions of a
+ * segment, which turns the steady-state projection cost from a global
+ * segment search into a constant-time refinement. Whenever the warm start
+ * diverges, the projector falls back to the global search of
+ * CubicSpline::getFrenetPositionWithFrame and re-seeds itself from its
+ * result.
+ *
+ * The projector does not own the spline; it must not outlive it.
+ */
+class SplineProjector {
+ public:
+  explicit SplineProjector(const CubicSpline* spline = nullptr)
+      : spline_(spline) {}
+
+  /** Rebinds the projector to a spline and discards the warm start. */
+  void reset(const CubicSpline* spline) {
+    spline_ = spline;
+    last_match_valid_ = false;
+  }
+
+  const CubicSpline* spline() const { return spline_; }
+
+  /**
+   * @brief Perpendicular projection of point onto the spline, warm-started
+   *        from the previous call.
+   *
+   * @param point: Point, which is projected perpendicular onto the spline
+   * @return FrenetPositionWithFrame
+   */
+  FrenetPositionWithFrame project(const CartesianPoint2D& point);
+
+ private:
+  const CubicSpline* spline_;
+  bool last_match_valid_{false};
+  SegmentInfo<DataIdx, RealType> last_match_;
+};
+
+}  // namespace cubic_spline
+}  // namespace corridor
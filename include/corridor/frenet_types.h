@@ -5,6 +5,7 @@
 #include "corridor/basic_types.h"
 #include "corridor/cartesian_types.h"
 #include "corridor/cubic_spline/cubic_spline_types.h"
+#include "corridor/internal/arc_length_index.h"
 
 namespace corridor {
 
@@ -105,21 +106,14 @@ class FrenetFrame2D {
       : frenet_base_(),
         origin_(0.0, 0.0),
         tangent_(0.0, 0.0),
-        normal_(0.0, 0.0) {
-    rotMat_F2C_ = RotationMatrix::Zero();
-    rotMat_C2F_ = RotationMatrix::Zero();
-  }
+        normal_(0.0, 0.0) {}
   FrenetFrame2D(const FrenetBase2D& other_base, const CartesianPoint2D& origin,
                 const CartesianVector2D& tangent,
                 const CartesianVector2D& normal)
       : frenet_base_(other_base),
         origin_(origin),
         tangent_(tangent),
-        normal_(normal) {
-    // Set rotation matrices (only for internal use)
-    rotMat_F2C_ << tangent_.x(), normal_.x(), tangent_.y(), normal_.y();
-    rotMat_C2F_ << tangent_.x(), tangent_.y(), normal_.x(), normal_.y();
-  }
+        normal_(normal) {}
 
   /**
    * @brief Conversion from Frenet-based point to Cartesian point.
@@ -179,9 +173,23 @@ class FrenetFrame2D {
   CartesianVector2D tangent_;
   CartesianVector2D normal_;
 
+  // The rotation matrices are fully determined by tangent and normal and
+  // derived on demand (two vector assembly instructions); not storing them
+  // roughly halves the frame footprint in FrenetFrames2D vectors and
+  // FrenetPositionsWithFrames, which are copied around by value.
   using RotationMatrix = Eigen::Matrix<RealType, 2, 2, Eigen::DontAlign>;
-  RotationMatrix rotMat_F2C_;  //< From Frenet to Cartesian
-  RotationMatrix rotMat_C2F_;  //< From Cartesian to Frenet
+  //! From Frenet to Cartesian
+  RotationMatrix rotMat_F2C() const {
+    RotationMatrix rot_mat;
+    rot_mat << tangent_.x(), normal_.x(), tangent_.y(), normal_.y();
+    return rot_mat;
+  }
+  //! From Cartesian to Frenet
+  RotationMatrix rotMat_C2F() const {
+    RotationMatrix rot_mat;
+    rot_mat << tangent_.x(), tangent_.y(), normal_.x(), normal_.y();
+    return rot_mat;
+  }
 
   using JacobianMatrix = Eigen::Matrix<RealType, 4, 4, Eigen::DontAlign>;
   JacobianMatrix defineJacobianMatrix(
@@ -194,12 +202,13 @@ inline std::ostream& operator<<(std::ostream& os, const FrenetFrame2D& ff) {
   os << "Origin: " << ff.origin().transpose() << "\n";
   os << "Tangent: " << ff.tangent().transpose() << "\n";
   os << "Normal: " << ff.normal().transpose() << "\n";
-  os << "rotMat_C2F:\n" << ff.rotMat_C2F_ << "\n";
-  os << "rotMat_F2C:\n" << ff.rotMat_F2C_ << "\n";
+  os << "rotMat_C2F:\n" << ff.rotMat_C2F() << "\n";
+  os << "rotMat_F2C:\n" << ff.rotMat_F2C() << "\n";
   return os;
 };
 
 struct FrenetPositionWithFrame {
+  FrenetPositionWithFrame() = default;
   FrenetPositionWithFrame(const FrenetFrame2D _frame,
                           const CartesianPoint2D& c_point)
       : frame(_frame) {
@@ -230,13 +239,20 @@ class FrenetPolyline {
 
   // Constr
   FrenetPolyline(const int size = 0) { data_.resize(DataType::kSize, size); }
+  /** Reconstructs a polyline from its data matrix, e.g. when loading
+   * serialized corridors. */
+  explicit FrenetPolyline(const DataMatrix& data) : data_(data) {}
 
   /** Number of points in the polyline definition. */
   int size() const { return data_.cols(); };
 
   /** The point at index idx in the polyline definition. */
   FrenetPoint2D GetPoint(const int idx) const { return data_.col(idx); }
-  void SetPoint(const int idx, const DataPoint& pt) { data_.col(idx) = pt; }
+  void SetPoint(const int idx, const DataPoint& pt) {
+    data_.col(idx) = pt;
+    // Invalidate the arc-length index; it is lazily rebuilt on the next query
+    arc_length_index_.clear();
+  }
 
   const FrenetPoint2D operator[](const int idx) const { return data_.col(idx); }
 
@@ -254,6 +270,26 @@ class FrenetPolyline {
    */
   RealType deviationAt(const RealType query_l) const;
 
+  /**
+   * @brief Eagerly builds the arc-length lookup index, which deviationAt
+   * otherwise builds lazily on its first query. A fully filled polyline
+   * whose index has been built can be queried from any number of threads
+   * concurrently; the lazy build is not thread-safe.
+   */
+  void buildArcLengthIndex() {
+    if (arc_length_index_.empty() && data_.cols() > 0) {
+      arc_length_index_.build(data_.row(DataType::kArclength));
+    }
+  }
+
+  /** Largest absolute deviation over all polyline points, e.g. for coarse
+   * corridor bounds. */
+  RealType maxAbsDeviation() const {
+    return (data_.cols() == 0)
+               ? 0.0
+               : data_.row(DataType::kDeviation).cwiseAbs().maxCoeff();
+  }
+
   // Introspection
   friend std::ostream& operator<<(std::ostream& os, const FrenetPolyline& fpl);
 
@@ -264,6 +300,12 @@ class FrenetPolyline {
    * number of points) Columns: one sample point m_i = [s_i, d_i]
    */
   DataMatrix data_;
+
+  /**
+   * Arc-length to segment lookup index. Since the polyline is filled point by
+   * point via SetPoint, it is built lazily on the first deviationAt query.
+   */
+  mutable ArcLengthIndex arc_length_index_;
 };
 
 inline std::ostream& operator<<(std::ostream& os, const FrenetPolyline& fpl) {
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <Eigen/Core>
+#include <algorithm>
+#include <vector>
+
+#include "corridor/basic_types.h"
+
+namespace corridor {
+
+/**
+ * @brief Precomputed lookup index from an arc-length value to the index of
+ *        the data segment which contains it.
+ *
+ * Built once over the increasing arc-length row of a spline or polyline data
+ * matrix. A uniform grid with one cell per segment on average resolves a
+ * query in O(1) instead of scanning all nodes. For strongly non-uniform
+ * sampling, where single grid cells would span many nodes, the index falls
+ * back to a binary search; for non-monotonic data it falls back to the plain
+ * linear scan.
+ */
+class ArcLengthIndex {
+ public:
+  /**
+   * @brief Builds the index from the arc-length row of a data matrix
+   *
+   * @param arc_lengths: row expression of arc-length values
+   */
+  template <typename Derived>
+  void build(const Eigen::DenseBase<Derived>& arc_lengths) {
+    clear();
+    const auto size = arc_lengths.size();
+    if (size < 2) {
+      return;
+    }
+    arc_lengths_.reserve(size);
+    monotonic_ = true;
+    for (Eigen::Index i = 0; i < size; i++) {
+      if (0 < i && arc_lengths(i) < arc_lengths_.back()) {
+        monotonic_ = false;
+      }
+      arc_lengths_.emplace_back(arc_lengths(i));
+    }
+
+    const RealType total_length = arc_lengths_.back() - arc_lengths_.front();
+    if (!monotonic_ || total_length <= 0.0) {
+      // Degenerate or unsorted data: lookup falls back to a linear scan
+      return;
+    }
+
+    // One grid cell per segment on average; grid_[c] holds the index of the
+    // segment which contains the lower edge of cell c.
+    const std::size_t num_cells = arc_lengths_.size() - 1;
+    inv_cell_size_ = static_cast<RealType>(num_cells) / total_length;
+    grid_.resize(num_cells);
+    std::size_t node_idx = 0;
+    std::size_t max_nodes_per_cell = 1;
+    for (std::size_t c = 0; c < num_cells; c++) {
+      const RealType cell_start =
+          arc_lengths_.front() + static_cast<RealType>(c) / inv_cell_size_;
+      const std::size_t first_node_idx = node_idx;
+      while (node_idx + 2 < arc_lengths_.size() &&
+             arc_lengths_[node_idx + 1] <= cell_start) {
+        node_idx++;
+      }
+      grid_[c] = node_idx;
+      max_nodes_per_cell =
+          std::max(max_nodes_per_cell, node_idx - first_node_idx + 1);
+    }
+
+    // Strongly non-uniform sampling: a single cell covers so many segments
+    // that the refinement walk costs more than a binary search.
+    if (kMaxNodesPerCell < max_nodes_per_cell) {
+      grid_.clear();
+    }
+  }
+
+  void clear() {
+    arc_lengths_.clear();
+    grid_.clear();
+    inv_cell_size_ = 0.0;
+  }
+  bool empty() const { return arc_lengths_.empty(); }
+
+  /**
+   * @brief Index of the segment which contains the query arc-length, clamped
+   *        to the first and last segment for out-of-range queries.
+   *
+   * @param arc_length: query arc-length
+   * @return Eigen::Index: segment index in [0, number of nodes - 2]
+   */
+  Eigen::Index segmentIndexAt(const RealType arc_length) const noexcept {
+    const auto max_index = static_cast<Eigen::Index>(arc_lengths_.size()) - 2;
+    if (max_index < 0) {
+      return 0;
+    }
+
+    if (!monotonic_) {
+      // Linear scan for the first node behind the query arc-length
+      for (Eigen::Index idx = 0; idx <= max_index; idx++) {
+        if (arc_length < arc_lengths_[idx + 1]) {
+          return idx;
+        }
+      }
+      return max_index;
+    }
+
+    if (arc_length <= arc_lengths_.front()) {
+      return 0;
+    }
+    if (arc_lengths_.back() <= arc_length) {
+      return max_index;
+    }
+
+    if (grid_.empty()) {
+      // Binary search fallback for strongly non-uniform sampling
+      const auto iter = std::upper_bound(arc_lengths_.begin(),
+                                         arc_lengths_.end(), arc_length);
+      const auto index =
+          static_cast<Eigen::Index>(iter - arc_lengths_.begin()) - 1;
+      return std::min(index, max_index);
+    }
+
+    const auto cell = std::min(
+        static_cast<std::size_t>((arc_length - arc_lengths_.front()) *
+                                 inv_cell_size_),
+        grid_.size() - 1);
+    std::size_t index = grid_[cell];
+    while (static_cast<Eigen::Index>(index) < max_index &&
+           arc_lengths_[index + 1] <= arc_length) {
+      index++;
+    }
+    return static_cast<Eigen::Index>(index);
+  }
+
+ private:
+  // Above this many nodes in one grid cell, a binary search is used instead
+  static constexpr std::size_t kMaxNodesPerCell = 8;
+
+  std::vector<RealType> arc_lengths_;  ///< Node arc-lengths, copied at build
+  std::vector<std::size_t> grid_;     ///< Cell index -> containing segment
+  RealType inv_cell_size_ = 0.0;
+  bool monotonic_ = true;
+};
+
+}  // namespace corridor
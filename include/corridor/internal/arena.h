@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace corridor {
+
+/**
+ * @brief Frame-scoped bump allocator for per-query temporaries.
+ *
+ * The query pipeline (projection candidate buckets, polyline conversion
+ * scratch) allocates short-lived vectors on every call. A QueryArena hands
+ * out memory by bumping a pointer through pre-allocated chunks and releases
+ * everything at once with reset(), typically once per processing cycle, so
+ * the temporaries of thousands of queries cost a handful of malloc calls in
+ * total.
+ *
+ * Typical usage, one arena per worker thread:
+ *
+ *   QueryArena arena;
+ *   while (running) {
+ *     ScopedQueryArena scope(arena);   // activate for this thread
+ *     ... corridor queries ...         // temporaries come from the arena
+ *     arena.reset();                   // end of cycle: rewind in O(chunks)
+ *   }
+ *
+ * The arena itself is not thread-safe; activation is per thread.
+ */
+class QueryArena {
+ public:
+  explicit QueryArena(const std::size_t initial_chunk_capacity = 1 << 16)
+      : next_chunk_capacity_(initial_chunk_capacity) {}
+
+  QueryArena(const QueryArena&) = delete;
+  QueryArena& operator=(const QueryArena&) = delete;
+
+  //! Returns properly aligned, uninitialized storage from the current chunk,
+  //! growing geometrically when a chunk is exhausted.
+  void* allocate(const std::size_t num_bytes, const std::size_t alignment) {
+    assert((alignment & (alignment - 1)) == 0);
+    if (!chunks_.empty()) {
+      Chunk& chunk = chunks_[active_chunk_];
+      const std::size_t aligned_offset =
+          (chunk.offset + alignment - 1) & ~(alignment - 1);
+      if (aligned_offset + num_bytes <= chunk.capacity) {
+        chunk.offset = aligned_offset + num_bytes;
+        return chunk.data.get() + aligned_offset;
+      }
+      // Reuse chunks surviving from before the last reset()
+      while (active_chunk_ + 1 < chunks_.size()) {
+        active_chunk_++;
+        Chunk& next_chunk = chunks_[active_chunk_];
+        if (num_bytes <= next_chunk.capacity) {
+          next_chunk.offset = num_bytes;
+          return next_chunk.data.get();
+        }
+      }
+    }
+    // Grow: new chunks double in size and always fit the request
+    while (next_chunk_capacity_ < num_bytes + alignment) {
+      next_chunk_capacity_ *= 2;
+    }
+    chunks_.emplace_back(next_chunk_capacity_);
+    next_chunk_capacity_ *= 2;
+    active_chunk_ = chunks_.size() - 1;
+    chunks_[active_chunk_].offset = num_bytes;
+    return chunks_[active_chunk_].data.get();
+  }
+
+  //! True if the pointer lies within one of the arena's chunks
+  bool owns(const void* const ptr) const {
+    for (const Chunk& chunk : chunks_) {
+      const unsigned char* const begin = chunk.data.get();
+      if (begin <= ptr && ptr < begin + chunk.capacity) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  //! Rewinds all chunks without freeing them. Everything allocated from the
+  //! arena is invalidated; arena-backed containers must not be used after
+  //! the reset.
+  void reset() {
+    for (Chunk& chunk : chunks_) {
+      chunk.offset = 0;
+    }
+    active_chunk_ = 0;
+  }
+
+  //! Bytes handed out since the last reset (diagnostics)
+  std::size_t bytesUsed() const {
+    std::size_t used = 0;
+    for (const Chunk& chunk : chunks_) {
+      used += chunk.offset;
+    }
+    return used;
+  }
+
+ private:
+  struct Chunk {
+    explicit Chunk(const std::size_t _capacity)
+        : data(new unsigned char[_capacity]), capacity(_capacity), offset(0) {}
+    std::unique_ptr<unsigned char[]> data;
+    std::size_t capacity;
+    std::size_t offset;
+  };
+  std::vector<Chunk> chunks_;
+  std::size_t active_chunk_ = 0;
+  std::size_t next_chunk_capacity_;
+};
+
+namespace detail {
+//! Arena active on the current thread; nullptr outside a ScopedQueryArena
+inline QueryArena*& ActiveQueryArena() {
+  static thread_local QueryArena* active_arena = nullptr;
+  return active_arena;
+}
+}  // namespace detail
+
+/**
+ * @brief Activates a QueryArena for the current thread for the lifetime of
+ *        the scope; the previously active arena (if any) is restored on
+ *        exit, so scopes nest.
+ */
+class ScopedQueryArena {
+ public:
+  explicit ScopedQueryArena(QueryArena& arena)
+      : previous_arena_(detail::ActiveQueryArena()) {
+    detail::ActiveQueryArena() = &arena;
+  }
+  ~ScopedQueryArena() { detail::ActiveQueryArena() = previous_arena_; }
+
+  ScopedQueryArena(const ScopedQueryArena&) = delete;
+  ScopedQueryArena& operator=(const ScopedQueryArena&) = delete;
+
+ private:
+  QueryArena* previous_arena_;
+};
+
+/**
+ * @brief std-compatible allocator that draws from the thread's active
+ *        QueryArena and falls back to the heap when none is active.
+ *
+ * The arena is captured at construction, so a container keeps its memory
+ * source for its whole lifetime even when the activation scope changes.
+ * Arena-backed deallocation is a no-op — memory is reclaimed collectively
+ * by QueryArena::reset() — which is what makes the per-query temporaries
+ * cheap. Containers using this allocator must therefore not outlive the
+ * arena's next reset.
+ */
+template <typename T>
+class ArenaAllocator {
+ public:
+  using value_type = T;
+
+  ArenaAllocator() : arena_(detail::ActiveQueryArena()) {}
+  explicit ArenaAllocator(QueryArena* const arena) : arena_(arena) {}
+  template <typename U>
+  ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena()) {}
+
+  T* allocate(const std::size_t num_elements) {
+    if (arena_ != nullptr) {
+      return static_cast<T*>(
+          arena_->allocate(num_elements * sizeof(T), alignof(T)));
+    }
+    return static_cast<T*>(::operator new(num_elements * sizeof(T)));
+  }
+
+  void deallocate(T* const ptr, const std::size_t /*num_elements*/) {
+    if (arena_ == nullptr) {
+      ::operator delete(ptr);
+    }
+    // Arena memory is reclaimed collectively by QueryArena::reset()
+  }
+
+  QueryArena* arena() const { return arena_; }
+
+  template <typename U>
+  bool operator==(const ArenaAllocator<U>& other) const {
+    return arena_ == other.arena();
+  }
+  template <typename U>
+  bool operator!=(const ArenaAllocator<U>& other) const {
+    return !(*this == other);
+  }
+
+ private:
+  QueryArena* arena_;
+};
+
+//! Vector drawing its storage from the thread's active QueryArena
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace corridor
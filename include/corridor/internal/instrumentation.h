@@ -0,0 +1,133 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+#ifdef CORRIDOR_ENABLE_INSTRUMENTATION
+#include <chrono>
+#endif
+
+namespace corridor {
+namespace instrumentation {
+
+/**
+ * Opt-in hot-path instrumentation. Compile with
+ * -DCORRIDOR_ENABLE_INSTRUMENTATION to activate it; without the flag the
+ * recording macros below expand to nothing, so release builds pay zero
+ * cost. When active, each thread accumulates into its own histograms (no
+ * locks on the hot path); snapshot them per worker thread via
+ * SnapshotThreadStats().
+ */
+
+//! Instrumented quantities
+enum class Metric : int {
+  kProjectionDurationNs = 0,  //< getFrenetPositionWithFrame wall time
+  kSegmentCandidateCount,     //< candidates per FindSegmentCandidates call
+  kProjectionOutcomeBrent,    //< segment projections resolved by Brent
+  kProjectionOutcomePolynomial,  //< resolved by the polynomial root method
+  kProjectionOutcomeClamped,     //< clamped to a segment boundary
+  kAssignmentConfidenceDurationNs,  //< ComputeAssignmentConfidence wall time
+  kGaussianIntegralEvaluations,     //< assignment integral kernel calls
+  kSize
+};
+
+//! Power-of-two histogram: bin i counts values in [2^i, 2^(i+1)), bin 0
+//! additionally holds 0 and 1. Covers nanosecond timings up to ~4 s.
+struct MetricHistogram {
+  static constexpr int kNumBins = 32;
+
+  std::uint64_t count = 0;
+  std::uint64_t sum = 0;
+  std::array<std::uint64_t, kNumBins> bins{};
+
+  void record(const std::uint64_t value) {
+    count++;
+    sum += value;
+    int bin = 0;
+    for (std::uint64_t v = value; 1 < v && bin < kNumBins - 1; v >>= 1) {
+      bin++;
+    }
+    bins[bin]++;
+  }
+};
+
+//! Exportable snapshot of one thread's accumulated metrics
+struct InstrumentationStats {
+  std::array<MetricHistogram, static_cast<int>(Metric::kSize)> histograms;
+
+  MetricHistogram& operator[](const Metric metric) {
+    return histograms[static_cast<int>(metric)];
+  }
+  const MetricHistogram& operator[](const Metric metric) const {
+    return histograms[static_cast<int>(metric)];
+  }
+
+  void record(const Metric metric, const std::uint64_t value) {
+    (*this)[metric].record(value);
+  }
+};
+
+#ifdef CORRIDOR_ENABLE_INSTRUMENTATION
+
+//! Accumulator of the calling thread
+inline InstrumentationStats& ThreadLocalStats() {
+  static thread_local InstrumentationStats stats;
+  return stats;
+}
+
+//! Copy of the calling thread's metrics for export
+inline InstrumentationStats SnapshotThreadStats() { return ThreadLocalStats(); }
+
+inline void ResetThreadStats() { ThreadLocalStats() = InstrumentationStats(); }
+
+//! Records the wall time of the enclosing scope in nanoseconds
+class ScopedTimer {
+ public:
+  explicit ScopedTimer(const Metric metric)
+      : metric_(metric), start_(std::chrono::steady_clock::now()) {}
+  ~ScopedTimer() {
+    const auto elapsed = std::chrono::steady_clock::now() - start_;
+    ThreadLocalStats().record(
+        metric_, static_cast<std::uint64_t>(
+                     std::chrono::duration_cast<std::chrono::nanoseconds>(
+                         elapsed)
+                         .count()));
+  }
+  ScopedTimer(const ScopedTimer&) = delete;
+  ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+ private:
+  Metric metric_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+#define CORRIDOR_INSTRUMENT_CONCAT_INNER(a, b) a##b
+#define CORRIDOR_INSTRUMENT_CONCAT(a, b) CORRIDOR_INSTRUMENT_CONCAT_INNER(a, b)
+
+#define CORRIDOR_INSTRUMENT_RECORD(metric, value)          \
+  ::corridor::instrumentation::ThreadLocalStats().record(  \
+      ::corridor::instrumentation::Metric::metric,         \
+      static_cast<std::uint64_t>(value))
+
+#define CORRIDOR_INSTRUMENT_SCOPED_TIMER(metric)            \
+  const ::corridor::instrumentation::ScopedTimer            \
+      CORRIDOR_INSTRUMENT_CONCAT(corridor_scoped_timer_,    \
+                                 __LINE__)(                 \
+          ::corridor::instrumentation::Metric::metric)
+
+#else  // CORRIDOR_ENABLE_INSTRUMENTATION
+
+//! Disabled builds export empty stats so callers need no ifdefs
+inline InstrumentationStats SnapshotThreadStats() {
+  return InstrumentationStats();
+}
+
+inline void ResetThreadStats() {}
+
+#define CORRIDOR_INSTRUMENT_RECORD(metric, value) (void)0
+#define CORRIDOR_INSTRUMENT_SCOPED_TIMER(metric) (void)0
+
+#endif  // CORRIDOR_ENABLE_INSTRUMENTATION
+
+}  // namespace instrumentation
+}  // namespace corridor
@@ -20,16 +20,22 @@ class OrientedBoundingBox {
  public:
   OrientedBoundingBox(const RealType orientation = 0.0,
                       const RealType length = 0.0, const RealType width = 0.0)
-      : orientation_(orientation), length_(length), width_(width) {}
+      : orientation_(orientation), length_(length), width_(width) {
+    initializeProjections();
+  }
 
   OrientedBoundingBox(const UncertainValue &orientation,
                       const UncertainValue &length, const UncertainValue &width)
-      : orientation_(orientation), length_(length), width_(width) {}
+      : orientation_(orientation), length_(length), width_(width) {
+    initializeProjections();
+  }
 
   OrientedBoundingBox(const OrientedBoundingBox &other)
       : orientation_(other.orientation_),
         length_(other.length_),
-        width_(other.width_) {}
+        width_(other.width_),
+        projection_x1_(other.projection_x1_),
+        projection_x2_(other.projection_x2_) {}
 
   // getter
   const UncertainValue &orientation() const { return orientation_; };
@@ -41,32 +47,20 @@ class OrientedBoundingBox {
    * orientation angle is given. It is assumed that the orientation is
    * defined  mathematically with respect to the x1 axis.
    *
+   * The box is immutable, so the projected extents are precomputed once in
+   * the constructors and these accessors are trivial loads; the assignment
+   * confidences call them repeatedly for the same box per cycle.
+   *
    * @return std::pair<RealType, RealType>: first: projection onto x1 axis
    *                                        second: projection onto x2 axis
    */
   std::pair<RealType, RealType> projection() const {
-    const auto cos = std::cos(orientation_.value);
-    const auto sin = std::sin(orientation_.value);
-    Eigen::Matrix2d projectionMatrix;
-    projectionMatrix << cos, sin, sin, cos;
-    const Eigen::Vector2d dimension(length_.value, width_.value);
-    const Eigen::Vector2d projection = projectionMatrix * dimension;
-    return std::make_pair(std::abs(projection.x()), std::abs(projection.y()));
+    return std::make_pair(projection_x1_, projection_x2_);
   }
 
-  RealType projectionX1() const {
-    const Eigen::Vector2d projection(std::cos(orientation_.value),
-                                     std::sin(orientation_.value));
-    const Eigen::Vector2d dimension(length_.value, width_.value);
-    return std::abs(projection.dot(dimension));
-  }
+  RealType projectionX1() const { return projection_x1_; }
 
-  RealType projectionX2() const {
-    const Eigen::Vector2d projection(std::sin(orientation_.value),
-                                     std::cos(orientation_.value));
-    const Eigen::Vector2d dimension(length_.value, width_.value);
-    return std::abs(projection.dot(dimension));
-  }
+  RealType projectionX2() const { return projection_x2_; }
 
   UncertainValue enclosingCircleRadius() const noexcept {
     const RealType squared_length = length_.value * length_.value;
@@ -82,9 +76,18 @@ class OrientedBoundingBox {
   }
 
  private:
+  void initializeProjections() {
+    const RealType cos = std::cos(orientation_.value);
+    const RealType sin = std::sin(orientation_.value);
+    projection_x1_ = std::abs(cos * length_.value + sin * width_.value);
+    projection_x2_ = std::abs(sin * length_.value + cos * width_.value);
+  }
+
   UncertainValue orientation_;  // [-pi,pi]
   UncertainValue length_;
   UncertainValue width_;
+  RealType projection_x1_ = 0.0;  // precomputed projected extents
+  RealType projection_x2_ = 0.0;
 };
 // introspection
 inline std::ostream &operator<<(std::ostream &os,
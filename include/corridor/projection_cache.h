@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "corridor/corridor.h"
+
+namespace corridor {
+
+/**
+ * @brief Memoization cache in front of Corridor::getFrenetPositionWithFrame
+ *        for repeated projections of static points.
+ *
+ * Static obstacles, map landmarks and sampled grid points are projected
+ * against unchanged corridors every cycle; the cache converts those repeated
+ * root-finding searches into one hash lookup. It is direct-mapped: the query
+ * position is quantized to a grid cell (configurable cell size), the cell
+ * index selects one slot in a fixed power-of-two table, and a colliding
+ * insert simply overwrites the slot — O(1) lookup and strictly bounded
+ * memory, no eviction bookkeeping.
+ *
+ * Results are always exact: a slot only hits if the stored query position is
+ * bit-identical to the requested one, the quantization is used solely for
+ * bucketing. Use one cache per corridor and thread (the cache itself is not
+ * synchronized; the corridor is only read) and clear() it whenever the
+ * corridor geometry changes.
+ */
+class ProjectionCache {
+ public:
+  explicit ProjectionCache(const RealType cell_size = 0.1,
+                           const std::size_t capacity = 4096)
+      : inverse_cell_size_(1.0 / cell_size),
+        slot_mask_(roundUpToPowerOfTwo(capacity) - 1),
+        slots_(slot_mask_ + 1) {}
+
+  //! Cached projection; falls through to the corridor on a miss and
+  //! memoizes the result
+  FrenetPositionWithFrame getFrenetPositionWithFrame(
+      const Corridor& corridor, const CartesianPoint2D& position) {
+    Slot& slot = slots_[slotIndex(position)];
+    if (slot.occupied && slot.query_position.x() == position.x() &&
+        slot.query_position.y() == position.y()) {
+      hits_++;
+      return slot.result;
+    }
+    misses_++;
+    slot.occupied = true;
+    slot.query_position = position;
+    slot.result = corridor.getFrenetPositionWithFrame(position);
+    return slot.result;
+  }
+
+  //! Invalidates all entries, e.g. after a corridor geometry update
+  void clear() {
+    for (Slot& slot : slots_) {
+      slot.occupied = false;
+    }
+    hits_ = 0;
+    misses_ = 0;
+  }
+
+  //! Number of slots (upper bound on cached entries)
+  std::size_t capacity() const noexcept { return slots_.size(); }
+
+  // Hit statistics since construction or the last clear()
+  std::uint64_t hits() const noexcept { return hits_; }
+  std::uint64_t misses() const noexcept { return misses_; }
+
+ private:
+  struct Slot {
+    bool occupied = false;
+    CartesianPoint2D query_position{0.0, 0.0};
+    FrenetPositionWithFrame result;
+  };
+
+  static std::size_t roundUpToPowerOfTwo(const std::size_t value) {
+    std::size_t power = 1;
+    while (power < value) {
+      power *= 2;
+    }
+    return power;
+  }
+
+  std::size_t slotIndex(const CartesianPoint2D& position) const {
+    const auto cell_x =
+        static_cast<std::int64_t>(std::floor(position.x() * inverse_cell_size_));
+    const auto cell_y =
+        static_cast<std::int64_t>(std::floor(position.y() * inverse_cell_size_));
+    // 2d variant of the Fibonacci multiplicative hash
+    const std::uint64_t hash =
+        static_cast<std::uint64_t>(cell_x) * 0x9E3779B97F4A7C15ull ^
+        static_cast<std::uint64_t>(cell_y) * 0xC2B2AE3D27D4EB4Full;
+    return static_cast<std::size_t>(hash >> 17) & slot_mask_;
+  }
+
+  RealType inverse_cell_size_;
+  std::size_t slot_mask_;
+  std::vector<Slot> slots_;
+  std::uint64_t hits_ = 0;
+  std::uint64_t misses_ = 0;
+};
+
+}  // namespace corridor
@@ -5,21 +5,45 @@
 namespace corridor {
 namespace unscented_transformation {
 
-Eigen::Vector2d CartesianToPolarTransformation2D(
-    const Eigen::Vector2d& cartesian_vector);
+// The transformations are parameterized on RealType (like the batched
+// variants below), so the library also compiles single precision with
+// -DCORRIDOR_REAL_TYPE_FLOAT.
+Eigen::Matrix<RealType, 2, 1> CartesianToPolarTransformation2D(
+    const Eigen::Matrix<RealType, 2, 1>& cartesian_vector);
 
-Eigen::Vector2d PolarToCartesianTransformation2D(
-    const Eigen::Vector2d& polar_vector);
+Eigen::Matrix<RealType, 2, 1> PolarToCartesianTransformation2D(
+    const Eigen::Matrix<RealType, 2, 1>& polar_vector);
 
-void ToPolarCoordinates2D(const Eigen::Vector2d& initial_x,
-                          const Eigen::Matrix2d& initial_P,
+void ToPolarCoordinates2D(const Eigen::Matrix<RealType, 2, 1>& initial_x,
+                          const Eigen::Matrix<RealType, 2, 2>& initial_P,
                           PolarVector2D* resulting_x,
                           PolarCovarianceMatrix2D* resulting_P);
 
 void FromPolarCoordinates2D(const PolarVector2D& initial_x,
                             const PolarCovarianceMatrix2D& initial_P,
-                            Eigen::Vector2d* resulting_x,
-                            Eigen::Vector2d* resulting_P);
+                            Eigen::Matrix<RealType, 2, 1>* resulting_x,
+                            Eigen::Matrix<RealType, 2, 1>* resulting_P);
+
+/**
+ * @brief Batched variant of ToPolarCoordinates2D over N states.
+ *
+ * Means are packed one state per column (2 x N), covariances as consecutive
+ * 2 x 2 blocks (2 x 2N). The sigma-point generator and its weights are set
+ * up once for the whole batch and the transformed means and covariances are
+ * written into the caller-provided storage with the same packing.
+ */
+void ToPolarCoordinates2D(
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_means,
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_cov_mats,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_means,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_cov_mats);
+
+//! Batched variant of FromPolarCoordinates2D, same packing as above
+void FromPolarCoordinates2D(
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_means,
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_cov_mats,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_means,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_cov_mats);
 
 }  // namespace unscented_transformation
 }  // namespace corridor
\ No newline at end of file
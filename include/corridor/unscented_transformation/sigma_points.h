@@ -47,18 +47,35 @@ class MerweScaledSigmaPoints {
   const SigmaPtsMatrixType& generateSigmaPoints(
       const Eigen::MatrixBase<DerivedVector>& x,
       const Eigen::MatrixBase<DerivedMatrix>& P) {
-    assert(x.rows() == n_ && P.rows() == n_ && P.cols() == n_);
+    assert(P.rows() == n_ && P.cols() == n_);
 
-    // create square root matrix
-    const CovarianceMatrixType sqrt_P = P.llt().matrixL();
+    // create square root matrix (in RealType, whatever the caller passed)
+    const CovarianceMatrixType sqrt_P =
+        P.template cast<RealType>().llt().matrixL();
 
-    sigma_pts_.col(0) = x;
+    return generateSigmaPointsFromSqrt(x, sqrt_P);
+  }
+
+  //! Sigma points from an already factorized covariance (lower-triangular
+  //! Cholesky factor), for callers that cache or update the factor
+  template <typename DerivedVector>
+  const SigmaPtsMatrixType& generateSigmaPointsFromSqrt(
+      const Eigen::MatrixBase<DerivedVector>& x,
+      const CovarianceMatrixType& sqrt_P) {
+    assert(x.rows() == n_);
+
+    // Bring the state into RealType once, so callers may pass any scalar
+    // (e.g. the double-typed generic state structs)
+    const Eigen::Matrix<RealType, n_, 1, Eigen::DontAlign> x_real =
+        x.template cast<RealType>();
+
+    sigma_pts_.col(0) = x_real;
     for (int i = 0; i < n_; i++) {
       const auto delta_x = sqrt_lambda_n_ * sqrt_P.col(i);
       // columns 1 -> n_ = x + sqrt((lambda + n_aug_) * P_)
-      sigma_pts_.col(i + 1) = x + delta_x;
+      sigma_pts_.col(i + 1) = x_real + delta_x;
       // columns n_aug_+1 -> 2*n_ = x - sqrt((lambda + n_aug_) * P_)
-      sigma_pts_.col(i + 1 + n_) = x - delta_x;
+      sigma_pts_.col(i + 1 + n_) = x_real - delta_x;
     }
 
     return sigma_pts_;
@@ -101,5 +118,103 @@ class MerweScaledSigmaPoints {
   }
 };
 
+/**
+ * @brief Sigma point generator with a persistent Cholesky factor, intended
+ * to live alongside a track across cycles.
+ *
+ * In steady-state tracking the covariance changes only marginally between
+ * cycles, yet generateSigmaPoints pays for a full llt() factorization every
+ * call. This wrapper keeps the previous covariance and its factor: when the
+ * covariance delta is small it applies a first-order triangular update
+ * (P + dP = L (I + F) L^T with F = L^-1 dP L^-T, keeping the lower
+ * triangle of F with halved diagonal), and only refactorizes from scratch
+ * when the relative change exceeds the threshold. The update error is
+ * second order in the relative delta, so with the default 1% threshold the
+ * sigma point spread stays within ~1e-4 of the exact factorization.
+ *
+ * @tparam NDim: dimension of the state vector, sigma points and weights
+ */
+template <int NDim>
+class PersistentMerweScaledSigmaPoints {
+ public:
+  using WeightVectorType =
+      typename MerweScaledSigmaPoints<NDim>::WeightVectorType;
+  using SigmaPtsMatrixType =
+      typename MerweScaledSigmaPoints<NDim>::SigmaPtsMatrixType;
+  using CovarianceMatrixType =
+      typename MerweScaledSigmaPoints<NDim>::CovarianceMatrixType;
+
+  PersistentMerweScaledSigmaPoints(
+      const RealType relative_update_threshold = 1e-2,
+      const RealType alpha = 1e-3, const RealType beta = 2.0,
+      const RealType kappa = 0.0)
+      : relative_update_threshold_(relative_update_threshold),
+        generator_(alpha, beta, kappa) {}
+
+  template <typename DerivedVector, typename DerivedMatrix>
+  const SigmaPtsMatrixType& generateSigmaPoints(
+      const Eigen::MatrixBase<DerivedVector>& x,
+      const Eigen::MatrixBase<DerivedMatrix>& P) {
+    assert(P.rows() == NDim && P.cols() == NDim);
+    const CovarianceMatrixType cov_mat = P.template cast<RealType>();
+
+    if (!has_factor_) {
+      factorizeFromScratch(cov_mat);
+    } else {
+      const CovarianceMatrixType delta = cov_mat - prev_cov_mat_;
+      const RealType delta_norm = delta.template lpNorm<1>();
+      if (delta_norm <= relative_update_threshold_ *
+                            prev_cov_mat_.template lpNorm<1>()) {
+        if (0.0 < delta_norm) {
+          updateFactor(delta);
+          prev_cov_mat_ = cov_mat;
+        }
+      } else {
+        factorizeFromScratch(cov_mat);
+      }
+    }
+
+    return generator_.generateSigmaPointsFromSqrt(x, sqrt_P_);
+  }
+
+  const WeightVectorType& weightsMean() const {
+    return generator_.weightsMean();
+  };
+  const WeightVectorType& weightsCovMat() const {
+    return generator_.weightsCovMat();
+  };
+
+  //! Drop the cached factor, e.g. after a track reset
+  void reset() { has_factor_ = false; }
+
+ private:
+  void factorizeFromScratch(const CovarianceMatrixType& cov_mat) {
+    sqrt_P_ = cov_mat.llt().matrixL();
+    prev_cov_mat_ = cov_mat;
+    has_factor_ = true;
+  }
+
+  void updateFactor(const CovarianceMatrixType& delta) {
+    // F = L^-1 * dP * L^-T; dP is symmetric, so solving the transposed
+    // system with the same triangle yields F directly
+    CovarianceMatrixType f = delta;
+    sqrt_P_.template triangularView<Eigen::Lower>().solveInPlace(f);
+    f.transposeInPlace();
+    sqrt_P_.template triangularView<Eigen::Lower>().solveInPlace(f);
+
+    // L_new = L * (I + tril(F) with halved diagonal), first order in dP
+    CovarianceMatrixType phi =
+        f.template triangularView<Eigen::StrictlyLower>();
+    phi.diagonal() = 0.5 * f.diagonal();
+    sqrt_P_ = sqrt_P_ + sqrt_P_ * phi;
+  }
+
+  RealType relative_update_threshold_;
+  MerweScaledSigmaPoints<NDim> generator_;
+  CovarianceMatrixType prev_cov_mat_;
+  CovarianceMatrixType sqrt_P_;
+  bool has_factor_ = false;
+};
+
 }  // namespace unscented_transformation
 }  // namespace corridor
\ No newline at end of file
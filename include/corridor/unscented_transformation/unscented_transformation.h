@@ -63,7 +63,8 @@ void EstimateStateMeanAndCovarianceMatrix(
   RealType two_pi = 2 * M_PI;
   for (int i = 0; i < n_sigma_pts; i++) {
     // state difference
-    Eigen::VectorXd x_diff = transformed_sigma_pts.col(i) - mean;
+    Eigen::Matrix<RealType, Eigen::Dynamic, 1> x_diff =
+        transformed_sigma_pts.col(i) - mean;
     if (0 <= angular_value_index) {
       // constrain angle residual between -pi and pi
       x_diff(j) = std::fmod(x_diff(j), two_pi);
@@ -75,5 +76,63 @@ void EstimateStateMeanAndCovarianceMatrix(
   }
 };
 
+/**
+ * @brief Batched unscented transformation over N states packed in
+ *        column-blocks: means as an NDim x N matrix, covariances as an
+ *        NDim x (NDim*N) matrix of consecutive NDim x NDim blocks.
+ *
+ * One sigma-point generator (and thus one weight initialization) is shared
+ * across the whole batch and the per-state temporaries are fixed-size, so
+ * the loop body reduces to the Cholesky factorization, the nonlinear map of
+ * 2*NDim+1 sigma points and the moment estimation per state — amenable to
+ * vectorization and trivially parallel over disjoint output blocks.
+ *
+ * @param means: packed initial means, one state per column
+ * @param cov_mats: packed initial covariances, one NDim x NDim block per
+ * state
+ * @param transform: nonlinear map applied to each sigma point column
+ * @param resulting_means / resulting_cov_mats: caller-provided storage with
+ * the same packing; only reallocated if the batch size changed
+ * @param angular_value_index: see EstimateStateMeanAndCovarianceMatrix
+ */
+template <int NDim, typename TransformFunction>
+void BatchUnscentedTransformation(
+    const Eigen::Matrix<RealType, NDim, Eigen::Dynamic>& means,
+    const Eigen::Matrix<RealType, NDim, Eigen::Dynamic>& cov_mats,
+    TransformFunction&& transform,
+    Eigen::Matrix<RealType, NDim, Eigen::Dynamic>* resulting_means,
+    Eigen::Matrix<RealType, NDim, Eigen::Dynamic>* resulting_cov_mats,
+    const int angular_value_index = -1) {
+  assert(resulting_means != nullptr && resulting_cov_mats != nullptr);
+  const auto num_states = means.cols();
+  assert(cov_mats.cols() == NDim * num_states);
+  if (resulting_means->cols() != num_states) {
+    resulting_means->resize(NDim, num_states);
+  }
+  if (resulting_cov_mats->cols() != NDim * num_states) {
+    resulting_cov_mats->resize(NDim, NDim * num_states);
+  }
+
+  // One generator for the whole batch: the weights only depend on the
+  // dimension and the spreading parameters
+  MerweScaledSigmaPoints<NDim> sigma_pts_generator;
+  constexpr int n_sigma_pts = 2 * NDim + 1;
+  Eigen::Matrix<RealType, NDim, n_sigma_pts, Eigen::DontAlign>
+      transformed_sigmas;
+
+  for (Eigen::Index i = 0; i < num_states; i++) {
+    const auto& sigmas = sigma_pts_generator.generateSigmaPoints(
+        means.col(i), cov_mats.template block<NDim, NDim>(0, NDim * i));
+    for (int s = 0; s < n_sigma_pts; s++) {
+      transformed_sigmas.col(s) = transform(sigmas.col(s));
+    }
+    EstimateStateMeanAndCovarianceMatrix(
+        transformed_sigmas, sigma_pts_generator.weightsMean(),
+        sigma_pts_generator.weightsCovMat(), resulting_means->col(i),
+        resulting_cov_mats->template block<NDim, NDim>(0, NDim * i),
+        angular_value_index);
+  }
+}
+
 }  // namespace unscented_transformation
 }  // namespace corridor
\ No newline at end of file
@@ -14,8 +14,11 @@
 #include "unscented_transformation_wrapper.hpp"
 
 namespace py = boost::python;
+namespace np = boost::python::numpy;
 
 BOOST_PYTHON_MODULE(PYTHON_API_MODULE_NAME) {  // NOLINT
+  // Required before any ndarray overload can be used
+  np::initialize();
 
   // ///////////////////////////////////////////////////////////////////////////
   // Cubic Spline
@@ -25,8 +28,10 @@ BOOST_PYTHON_MODULE(PYTHON_API_MODULE_NAME) {  // NOLINT
       "CubicSplineWrapper", py::init<int, const py::list&, const py::list&>())
       .def(py::init<int, const py::list&, const py::list&, const py::list&,
                     const py::list&>())
+      .def(py::init<int, const np::ndarray&>())
       .def("total_length", &CubicSplineWrapper::GetTotalLength)
-      .def("get_polyline", &CubicSplineWrapper::getPolyline);
+      .def("get_polyline", &CubicSplineWrapper::getPolyline)
+      .def("get_polyline_array", &CubicSplineWrapper::getPolylineArray);
 
   // ///////////////////////////////////////////////////////////////////////////
   // Corridor Wrapper
@@ -35,8 +40,16 @@ BOOST_PYTHON_MODULE(PYTHON_API_MODULE_NAME) {  // NOLINT
                               py::init<int, const py::list&, const py::list&>())
       .def(py::init<int, const py::list&, const py::list&, const py::list&,
                     const py::list&>())
+      .def(py::init<int, const np::ndarray&, const np::ndarray&,
+                    const np::ndarray&>())
       .def("get_polylines", &CorridorWrapper::GetCartesianPolylinesLines)
+      .def("get_polylines_arrays", &CorridorWrapper::GetCartesianPolylinesArrays)
       .def("to_frenet_state_vector", &CorridorWrapper::ToFrenetStateVector)
+      .def("to_frenet_batch", &CorridorWrapper::ToFrenetBatch)
+      .def("to_frenet_state_vector_array",
+           &CorridorWrapper::ToFrenetStateVectorArray,
+           (py::arg("cartesian_states"), py::arg("moving_frenet_frame"),
+            py::arg("num_threads") = 0))
       .def("to_frenet_state", &CorridorWrapper::ToFrenetState)
       .def("get_frenet_frame_dict", &CorridorWrapper::GetFrenetFrame)
       .def("length_reference_line", &CorridorWrapper::lengthReferenceLine)
@@ -122,6 +135,9 @@ BOOST_PYTHON_MODULE(PYTHON_API_MODULE_NAME) {  // NOLINT
                      &FlatCorridorRelatedFeatures::corridor_length);
 
   //! callable functions in Python
+  py::def("AssignObjectsToCorridors", &AssignObjectsToCorridorsBatch,
+          (py::arg("object_states"), py::arg("object_boxes"),
+           py::arg("corridors"), py::arg("num_threads") = 0));
   py::def("LateralAssignmentConfidence", &LateralAssignmentConfidence);
   py::def("LongitudinalAssignmentConfidence",
           &LongitudinalAssignmentConfidence);
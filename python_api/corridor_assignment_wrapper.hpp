@@ -9,6 +9,10 @@
 #include "corridor/corridor_assignment/corridor_related_semantics.h"
 #include "corridor/internal/math.h"
 
+// Phython API
+#include "corridor_wrapper.hpp"
+#include "utility.hpp"
+
 namespace py = boost::python;
 
 // /////////////////////////////////////////////////////////////////////////////
@@ -83,6 +87,105 @@ corridor::RealType MovingConfidence(const corridor::RealType abs_velocity,
   return corridor::MovingConfidence({abs_velocity, std_velocity}, sigma_band);
 }
 
+/**
+ * Scene-level assignment in one call: evaluates the confidences of all
+ * objects against all corridors entirely in C++ instead of crossing the
+ * Python boundary per (object, corridor) pair.
+ *
+ * @param object_states: C-contiguous (N, 14) float64 array, one object per
+ * row in the field order of FlatCartesianStateAndCovMat2D (x, y, vx, vy,
+ * var_x, var_y, var_vx, var_vy, cov_xy, cov_xvx, cov_xvy, cov_yvx, cov_yvy,
+ * cov_vxvy)
+ * @param object_boxes: C-contiguous (N, 6) float64 array, one box per row
+ * as (orientation, length, width, sigma_orientation, sigma_length,
+ * sigma_width)
+ * @param py_corridors: list of CorridorWrapper handles
+ * @param num_threads: worker threads for the batch engine; 0 selects the
+ * hardware concurrency
+ * @return (N, M) confidence matrix, one row per object and one column per
+ * corridor
+ */
+np::ndarray AssignObjectsToCorridorsBatch(const np::ndarray& object_states,
+                                          const np::ndarray& object_boxes,
+                                          const py::list& py_corridors,
+                                          const std::size_t num_threads = 0) {
+  using namespace corridor;
+  expect_row_layout(object_states, 14,
+                    "expected a C-contiguous (N, 14) float64 state array in "
+                    "FlatCartesianStateAndCovMat2D field order");
+  expect_row_layout(object_boxes, 6,
+                    "expected a C-contiguous (N, 6) float64 box array "
+                    "(orientation, length, width and standard deviations)");
+  const long num_objects = object_states.shape(0);
+  if (object_boxes.shape(0) != num_objects) {
+    PyErr_SetString(PyExc_ValueError,
+                    "object_states and object_boxes differ in length");
+    py::throw_error_already_set();
+  }
+
+  const Eigen::Map<const Eigen::Matrix<RealType, 14, Eigen::Dynamic>>
+      states_map(reinterpret_cast<const RealType*>(object_states.get_data()),
+                 14, num_objects);
+  const Eigen::Map<const Eigen::Matrix<RealType, 6, Eigen::Dynamic>> boxes_map(
+      reinterpret_cast<const RealType*>(object_boxes.get_data()), 6,
+      num_objects);
+
+  std::vector<CartesianState2D> cartesian_states;
+  std::vector<OrientedBoundingBox> oriented_bounding_boxes;
+  cartesian_states.reserve(num_objects);
+  oriented_bounding_boxes.reserve(num_objects);
+  for (long i = 0; i < num_objects; i++) {
+    FlatCartesianStateAndCovMat2D flat_state;
+    flat_state.x = states_map(0, i);
+    flat_state.y = states_map(1, i);
+    flat_state.vx = states_map(2, i);
+    flat_state.vy = states_map(3, i);
+    flat_state.var_x = states_map(4, i);
+    flat_state.var_y = states_map(5, i);
+    flat_state.var_vx = states_map(6, i);
+    flat_state.var_vy = states_map(7, i);
+    flat_state.cov_xy = states_map(8, i);
+    flat_state.cov_xvx = states_map(9, i);
+    flat_state.cov_xvy = states_map(10, i);
+    flat_state.cov_yvx = states_map(11, i);
+    flat_state.cov_yvy = states_map(12, i);
+    flat_state.cov_vxvy = states_map(13, i);
+    cartesian_states.emplace_back(Convert(flat_state));
+
+    oriented_bounding_boxes.emplace_back(
+        UncertainValue(boxes_map(0, i), boxes_map(3, i)),
+        UncertainValue(boxes_map(1, i), boxes_map(4, i)),
+        UncertainValue(boxes_map(2, i), boxes_map(5, i)));
+  }
+
+  // Non-owning handles into the wrapper objects; the caller's list keeps
+  // them alive for the duration of the call
+  CorridorPtrs corridors;
+  const long num_corridors = py::len(py_corridors);
+  corridors.reserve(num_corridors);
+  for (long j = 0; j < num_corridors; j++) {
+    CorridorWrapper& wrapper = py::extract<CorridorWrapper&>(py_corridors[j]);
+    corridors.emplace_back(&wrapper.corridor_, [](Corridor*) {});
+  }
+
+  np::ndarray result =
+      np::empty(py::make_tuple(num_objects, num_corridors),
+                np::dtype::get_builtin<RealType>());
+  Eigen::Map<
+      Eigen::Matrix<RealType, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>
+      result_map(reinterpret_cast<RealType*>(result.get_data()), num_objects,
+                 num_corridors);
+  {
+    // Scoped so the GIL is reacquired before the result object is returned
+    ScopedGilRelease gil_release;
+    AssignmentConfidenceMatrix confidences;
+    AssignObjectsToCorridors(cartesian_states, oriented_bounding_boxes,
+                             corridors, &confidences, num_threads);
+    result_map = confidences;
+  }
+  return result;
+}
+
 py::dict RelativeDirectionConfidence(const corridor::RealType heading_mean,
                                      const corridor::RealType heading_std,
                                      const corridor::RealType sigma_band) {
@@ -2,6 +2,10 @@
 
 #include <boost/python.hpp>
 
+#include <atomic>
+#include <thread>
+#include <vector>
+
 #include "corridor/corridor.h"
 
 // Phython API
@@ -42,6 +46,18 @@ struct CorridorWrapper {
                          distance_left_boundary, distance_right_boundary);
   }
 
+  //! Zero-copy construction from C-contiguous (N, 2) float64 numpy arrays
+  //! for reference line and both boundaries; the buffers are wrapped with
+  //! Eigen views, no per-element conversion
+  CorridorWrapper(const int id, const np::ndarray& reference_line,
+                  const np::ndarray& left_boundary,
+                  const np::ndarray& right_boundary) {
+    using namespace corridor;
+    corridor_ = Corridor(id, to_points_view(reference_line),
+                         to_points_view(left_boundary),
+                         to_points_view(right_boundary));
+  }
+
   py::dict GetCartesianPolylinesLines(const corridor::RealType delta_s) {
     using namespace corridor;
     // Construct Cartesian polylines form corridors reference line and
@@ -72,6 +88,126 @@ struct CorridorWrapper {
     return polylines;
   }
 
+  py::dict GetCartesianPolylinesArrays(const corridor::RealType delta_s) {
+    using namespace corridor;
+    // Array counterpart of GetCartesianPolylinesLines: the sampled polylines
+    // are moved into (N, 2) numpy arrays with one bulk copy each instead of
+    // per-element list appends
+    CartesianPoints2D reference_line;
+    CartesianPoints2D left_boundary;
+    CartesianPoints2D right_boundary;
+
+    corridor_.fillCartesianPolylines(&reference_line, &left_boundary,
+                                     &right_boundary, delta_s);
+
+    const auto to_array = [](const CartesianPoints2D& points) {
+      np::ndarray array = make_points_array(points.size());
+      if (!points.empty()) {
+        // A vector of Vector2d is contiguous, one block assignment suffices
+        points_array_map(array) = CartesianPointsView2D(
+            points.front().data(), 2, static_cast<Eigen::Index>(points.size()));
+      }
+      return array;
+    };
+
+    py::dict polylines;
+    polylines["reference_line"] = to_array(reference_line);
+    polylines["left_boundary"] = to_array(left_boundary);
+    polylines["right_boundary"] = to_array(right_boundary);
+    return polylines;
+  }
+
+  np::ndarray ToFrenetBatch(const np::ndarray& positions) {
+    using namespace corridor;
+    // Projects a whole (N, 2) point grid onto the reference line in one
+    // batched call with the GIL released, returning (l, d) rows
+    const CartesianPointsView2D points_view = to_points_view(positions);
+    const long num_points = points_view.cols();
+    np::ndarray frenet_points = make_points_array(num_points);
+    auto frenet_map = points_array_map(frenet_points);
+    {
+      ScopedGilRelease gil_release;
+      const FrenetPolyline polyline = corridor_.toFrenetPolyline(points_view);
+      for (long i = 0; i < num_points; i++) {
+        frenet_map.col(i) = polyline.GetPoint(i);
+      }
+    }
+    return frenet_points;
+  }
+
+  np::ndarray ToFrenetStateVectorArray(const np::ndarray& cartesian_states,
+                                       const bool moving_frenet_frame,
+                                       const std::size_t num_threads = 0) {
+    using namespace corridor;
+    // Batch counterpart of ToFrenetStateVector: rows of (x, y, vx, vy) in,
+    // rows of (l, d, vl, vd) out, both accessed through Eigen views. The GIL
+    // is released for the conversion, which is distributed over num_threads
+    // workers (0: hardware concurrency) claiming rows from an atomic counter.
+    expect_row_layout(
+        cartesian_states, 4,
+        "expected a C-contiguous (N, 4) float64 state array (x, y, vx, vy)");
+    const long num_states = cartesian_states.shape(0);
+    const Eigen::Map<const Eigen::Matrix<RealType, 4, Eigen::Dynamic>>
+        states_map(
+            reinterpret_cast<const RealType*>(cartesian_states.get_data()), 4,
+            num_states);
+
+    np::ndarray frenet_states =
+        np::empty(py::make_tuple(num_states, 4),
+                  np::dtype::get_builtin<RealType>());
+    Eigen::Map<Eigen::Matrix<RealType, 4, Eigen::Dynamic>> frenet_map(
+        reinterpret_cast<RealType*>(frenet_states.get_data()), 4, num_states);
+
+    {
+      // Scoped so the GIL is reacquired before the result object is returned
+      ScopedGilRelease gil_release;
+
+      const auto convert_state = [&](const long i) {
+        const CartesianStateVector2D cartesian_state_vector(
+            states_map(0, i), states_map(1, i), states_map(2, i),
+            states_map(3, i));
+        const FrenetFrame2D frenet_frame =
+            corridor_.FrenetFrame(cartesian_state_vector.position());
+        const FrenetStateVector2D frenet_state =
+            frenet_frame.FromCartesianStateVector(cartesian_state_vector,
+                                                  moving_frenet_frame);
+        frenet_map.col(i) << frenet_state.l(), frenet_state.d(),
+            frenet_state.vl(), frenet_state.vd();
+      };
+
+      std::size_t worker_count = (num_threads == 0)
+                                     ? std::thread::hardware_concurrency()
+                                     : num_threads;
+      worker_count = std::max<std::size_t>(
+          1, std::min<std::size_t>(worker_count,
+                                   static_cast<std::size_t>(num_states)));
+
+      if (worker_count <= 1) {
+        for (long i = 0; i < num_states; i++) {
+          convert_state(i);
+        }
+      } else {
+        std::atomic<long> next_index{0};
+        const auto worker = [&]() {
+          for (long i = next_index++; i < num_states; i = next_index++) {
+            convert_state(i);
+          }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(worker_count - 1);
+        for (std::size_t i = 0; i + 1 < worker_count; i++) {
+          threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& thread : threads) {
+          thread.join();
+        }
+      }
+    }
+    return frenet_states;
+  }
+
   py::list ToFrenetStateVector(const py::list& py_cartesian_state_vector,
                                const bool moving_frenet_frame) {
     using namespace corridor;
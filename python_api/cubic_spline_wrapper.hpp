@@ -40,6 +40,12 @@ struct CubicSplineWrapper {
     CartesianVector2D last_tangent = to_cartesian_vector(py_last_tangent);
     cubic_spline_ = cs::CubicSpline(id, points, first_tangent, last_tangent);
   }
+  //! Zero-copy construction from a C-contiguous (N, 2) float64 numpy array:
+  //! the node buffer is wrapped with an Eigen view, no per-element conversion
+  CubicSplineWrapper(const int id, const np::ndarray& points) {
+    cubic_spline_ = cs::CubicSpline(id, to_points_view(points));
+  }
+
   const cr::RealType GetTotalLength() { return cubic_spline_.GetTotalLength(); }
 
   py::dict getPolyline(const corridor::RealType delta_l) {
@@ -65,4 +71,22 @@ struct CubicSplineWrapper {
     polyline_dict["y"] = py_polyline.second;
     return polyline_dict;
   }
+
+  np::ndarray getPolylineArray(const corridor::RealType delta_l) {
+    // Same sampling as getPolyline, but the positions are written directly
+    // into the returned (N, 2) numpy array through an Eigen view
+    using namespace corridor;
+    const RealType max_length = cubic_spline_.GetTotalLength();
+    const long num_regular_samples =
+        static_cast<long>(max_length / delta_l) + 1;
+    np::ndarray polyline = make_points_array(num_regular_samples + 1);
+    auto polyline_map = points_array_map(polyline);
+    for (long i = 0; i < num_regular_samples; i++) {
+      polyline_map.col(i) = cubic_spline_.GetPositionAt(i * delta_l);
+    }
+    // Add last point
+    polyline_map.col(num_regular_samples) =
+        cubic_spline_.GetPositionAt(max_length);
+    return polyline;
+  }
 };
\ No newline at end of file
@@ -23,16 +23,20 @@ corridor::StateMeanAndCovarianceMatrix UnscentedTransformationPolarCoordinates(
   corridor::PolarVector2D polar_mean;
   corridor::PolarCovarianceMatrix2D polar_cov_mat;
 
-  ut::ToPolarCoordinates2D(initial_state.mean, initial_state.covMat,
+  // The generic state struct is double-typed; the library API is RealType
+  ut::ToPolarCoordinates2D(initial_state.mean.cast<corridor::RealType>(),
+                           initial_state.covMat.cast<corridor::RealType>(),
                            &polar_mean, &polar_cov_mat);
 
-  return corridor::StateMeanAndCovarianceMatrix(polar_mean, polar_cov_mat);
+  return corridor::StateMeanAndCovarianceMatrix(
+      polar_mean.cast<double>(), polar_cov_mat.cast<double>());
 };
 
 py::list pyCartesianToPolarTransformation2D(const corridor::RealType x1,
                                             const corridor::RealType x2) {
   namespace ut = corridor::unscented_transformation;
-  Eigen::Vector2d polar_vector = ut::CartesianToPolarTransformation2D({x1, x2});
+  const Eigen::Matrix<corridor::RealType, 2, 1> polar_vector =
+      ut::CartesianToPolarTransformation2D({x1, x2});
   py::list polar_coordinates;
   polar_coordinates.append(polar_vector(0));
   polar_coordinates.append(polar_vector(1));
@@ -42,7 +46,7 @@ py::list pyCartesianToPolarTransformation2D(const corridor::RealType x1,
 py::list pyPolarToCartesianTransformation2D(const corridor::RealType radius,
                                             const corridor::RealType phi) {
   namespace ut = corridor::unscented_transformation;
-  Eigen::Vector2d cartesian_vector =
+  const Eigen::Matrix<corridor::RealType, 2, 1> cartesian_vector =
       ut::PolarToCartesianTransformation2D({radius, phi});
   py::list cartesian_coordinates;
   cartesian_coordinates.append(cartesian_vector(0));
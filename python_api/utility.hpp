@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/python.hpp>
+#include <boost/python/numpy.hpp>
 
 #include "corridor/basic_types.h"
 #include "corridor/cartesian_types.h"
@@ -8,12 +9,65 @@
 #include "corridor/frenet_types.h"
 
 namespace py = boost::python;
+namespace np = boost::python::numpy;
 namespace cs = corridor::cubic_spline;
 
 // /////////////////////////////////////////////////////////////////////////////
 // Utility functions
 // /////////////////////////////////////////////////////////////////////////////
 
+//! Raises ValueError unless the array is a C-contiguous (N, row_size)
+//! float64 array, the layout the zero-copy views below expect
+inline void expect_row_layout(const np::ndarray& array, const int row_size,
+                              const char* description) {
+  if (array.get_nd() != 2 || array.shape(1) != row_size ||
+      array.get_dtype() != np::dtype::get_builtin<corridor::RealType>() ||
+      !(array.get_flags() & np::ndarray::C_CONTIGUOUS)) {
+    PyErr_SetString(PyExc_ValueError, description);
+    py::throw_error_already_set();
+  }
+}
+
+//! Wraps a C-contiguous (N, 2) float64 array of points as a 2 x N Eigen
+//! view without copying: each row (x, y) becomes one column of the view
+inline corridor::CartesianPointsView2D to_points_view(
+    const np::ndarray& points) {
+  expect_row_layout(points, 2,
+                    "expected a C-contiguous (N, 2) float64 point array");
+  return corridor::CartesianPointsView2D(
+      reinterpret_cast<const corridor::RealType*>(points.get_data()), 2,
+      points.shape(0));
+}
+
+//! Allocates an uninitialized (num_points, 2) float64 array; fill it
+//! through points_array_map so no intermediate buffer is needed
+inline np::ndarray make_points_array(const long num_points) {
+  return np::empty(py::make_tuple(num_points, 2),
+                   np::dtype::get_builtin<corridor::RealType>());
+}
+
+//! Mutable 2 x N Eigen view onto an array created by make_points_array
+inline Eigen::Map<corridor::CartesianPointsMatrix2D> points_array_map(
+    np::ndarray& points) {
+  return Eigen::Map<corridor::CartesianPointsMatrix2D>(
+      reinterpret_cast<corridor::RealType*>(points.get_data()), 2,
+      points.shape(0));
+}
+
+//! Releases the GIL for the lifetime of the object so batch methods can run
+//! (and spawn worker threads) without serializing the Python interpreter.
+//! No Python objects may be touched while it is alive.
+class ScopedGilRelease {
+ public:
+  ScopedGilRelease() : thread_state_(PyEval_SaveThread()) {}
+  ~ScopedGilRelease() { PyEval_RestoreThread(thread_state_); }
+  ScopedGilRelease(const ScopedGilRelease&) = delete;
+  ScopedGilRelease& operator=(const ScopedGilRelease&) = delete;
+
+ private:
+  PyThreadState* thread_state_;
+};
+
 template <typename T>
 inline std::vector<T> to_std_vector(const py::object& iterable) {
   return std::vector<T>(py::stl_input_iterator<T>(iterable),
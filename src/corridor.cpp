@@ -1,5 +1,7 @@
 #include "corridor/corridor.h"
 
+#include <algorithm>
+
 #include "corridor/cubic_spline/cubic_spline.h"
 #include "corridor/cubic_spline/cubic_spline_coefficients.h"
 
@@ -81,6 +83,7 @@ Corridor::Corridor(const IdType id, const CartesianPoints2D& reference_line_pts,
     left_bound_.SetPoint(i, {arc_length, distance_left_boundary});
     right_bound_.SetPoint(i, {arc_length, -distance_right_boundary});
   }
+  precomputeDeviationBound();
 }
 
 Corridor::Corridor(const IdType id, const CartesianPoints2D& reference_line_pts,
@@ -98,6 +101,7 @@ Corridor::Corridor(const IdType id, const CartesianPoints2D& reference_line_pts,
     left_bound_.SetPoint(i, {arc_length, distance_left_boundary});
     right_bound_.SetPoint(i, {arc_length, -distance_right_boundary});
   }
+  precomputeDeviationBound();
 }
 
 Corridor::Corridor(const IdType id, const CartesianPoints2D& reference_line_pts,
@@ -106,6 +110,19 @@ Corridor::Corridor(const IdType id, const CartesianPoints2D& reference_line_pts,
   reference_line_ = cs::CubicSpline(id, reference_line_pts);
   left_bound_ = reference_line_.toFrenetPolyline(left_boundary_pts);
   right_bound_ = reference_line_.toFrenetPolyline(right_boundary_pts);
+  precomputeDeviationBound();
+}
+
+Corridor::Corridor(const IdType id,
+                   const CartesianPointsView2D& reference_line_pts,
+                   const CartesianPointsView2D& left_boundary_pts,
+                   const CartesianPointsView2D& right_boundary_pts) {
+  reference_line_ = cs::CubicSpline(id, reference_line_pts);
+  // The views bind directly to the batched projection kernel; no point
+  // vectors are materialized on this path
+  left_bound_ = reference_line_.projectPoints(left_boundary_pts);
+  right_bound_ = reference_line_.projectPoints(right_boundary_pts);
+  precomputeDeviationBound();
 }
 
 Corridor::Corridor(const IdType id, const CartesianPoints2D& reference_line_pts,
@@ -117,6 +134,45 @@ Corridor::Corridor(const IdType id, const CartesianPoints2D& reference_line_pts,
       cs::CubicSpline(id, reference_line_pts, first_tangent, last_tangent);
   left_bound_ = reference_line_.toFrenetPolyline(left_boundary_pts);
   right_bound_ = reference_line_.toFrenetPolyline(right_boundary_pts);
+  precomputeDeviationBound();
+}
+
+void Corridor::precomputeDeviationBound() {
+  // Build the boundary lookup indexes now instead of lazily on the first
+  // width/boundary query: a fully constructed Corridor is then immutable
+  // under const queries, so snapshots can be read by multiple threads.
+  left_bound_.buildArcLengthIndex();
+  right_bound_.buildArcLengthIndex();
+
+  const auto& data = reference_line_.GetData();
+  const auto num_nodes = data.cols();
+  if (num_nodes < 2) {
+    half_max_segment_length_ = 0.0;
+    max_boundary_deviation_ = 0.0;
+    return;
+  }
+  const auto& arc_lengths = data.row(cs::kArcLength);
+  half_max_segment_length_ = 0.5 * (arc_lengths.tail(num_nodes - 1) -
+                                    arc_lengths.head(num_nodes - 1))
+                                       .maxCoeff();
+  max_boundary_deviation_ =
+      std::max(left_bound_.maxAbsDeviation(), right_bound_.maxAbsDeviation());
+}
+
+RealType Corridor::minDistanceBound(
+    const CartesianPoint2D& position) const noexcept {
+  const auto& data = reference_line_.GetData();
+  if (data.cols() == 0) {
+    return std::numeric_limits<RealType>::max();
+  }
+  const RealType min_node_distance = std::sqrt(
+      (data.topRows<2>().colwise() - position).colwise().squaredNorm().minCoeff());
+  return std::max(RealType(0.0), min_node_distance - half_max_segment_length_);
+}
+
+bool Corridor::canContainPoint(const CartesianPoint2D& position,
+                               const RealType margin) const noexcept {
+  return minDistanceBound(position) <= max_boundary_deviation_ + margin;
 }
 
 BoundaryDistances Corridor::signedDistancesAt(
@@ -135,6 +191,15 @@ RealType Corridor::centerOffset(const RealType arc_length) const noexcept {
   return (distances.first + distances.second) * 0.5;
 }
 
+BoundaryInfo Corridor::boundaryInfoAt(const RealType arc_length) const noexcept {
+  BoundaryInfo info;
+  info.distance_left = left_bound_.deviationAt(arc_length);
+  info.distance_right = right_bound_.deviationAt(arc_length);
+  info.width = info.distance_left + std::abs(info.distance_right);
+  info.center_offset = (info.distance_left + info.distance_right) * 0.5;
+  return info;
+}
+
 RealType Corridor::lengthReferenceLine() const noexcept {
   return reference_line_.GetTotalLength();
 }
@@ -175,11 +240,52 @@ void Corridor::fillCartesianPolylines(
   FillBoundaryPolyline(reference_line_, right_bound_, right_polyline);
 }
 
+cs::DataSize Corridor::sampleCartesianPolylines(
+    const RealType delta_l,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* reference_polyline,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* left_polyline,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* right_polyline) const noexcept {
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> normals;
+  const cs::DataSize num_samples = reference_line_.sampleCartesianPolyline(
+      delta_l, reference_polyline, &normals);
+  left_polyline->resize(2, num_samples);
+  right_polyline->resize(2, num_samples);
+  if (num_samples == 0) {
+    return 0;
+  }
+
+  // Boundary deviations per sample; the lookup per query is O(1)
+  const RealType total_length = reference_line_.GetTotalLength();
+  Eigen::Array<RealType, 1, Eigen::Dynamic> left_deviations(num_samples);
+  Eigen::Array<RealType, 1, Eigen::Dynamic> right_deviations(num_samples);
+  for (cs::DataSize i = 0; i < num_samples; i++) {
+    const RealType query_l =
+        std::min(static_cast<RealType>(i) * delta_l, total_length);
+    left_deviations(i) = left_bound_.deviationAt(query_l);
+    right_deviations(i) = right_bound_.deviationAt(query_l);
+  }
+
+  // boundary = reference line + deviation * normal, vectorized over samples
+  left_polyline->noalias() =
+      *reference_polyline +
+      (normals.array().rowwise() * left_deviations).matrix();
+  right_polyline->noalias() =
+      *reference_polyline +
+      (normals.array().rowwise() * right_deviations).matrix();
+  return num_samples;
+}
+
 FrenetPolyline Corridor::toFrenetPolyline(
     const CartesianPoints2D& cartesian_polyline) const {
   return reference_line_.toFrenetPolyline(cartesian_polyline);
 }
 
+FrenetPolyline Corridor::toFrenetPolyline(
+    const Eigen::Ref<const Eigen::Matrix<RealType, 2, Eigen::Dynamic>>&
+        cartesian_points) const {
+  return reference_line_.projectPoints(cartesian_points);
+}
+
 CartesianPoint2D Corridor::toCartesianPoint(
     const FrenetPoint2D& frenet_point) const {
   const CartesianPoint2D position =
@@ -189,71 +295,69 @@ CartesianPoint2D Corridor::toCartesianPoint(
   return position + frenet_point.d() * normal;
 }
 
+cs::DataSize Corridor::toCartesianPolyline(
+    const FrenetPoints2D& frenet_points,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* cartesian_points) const {
+  return reference_line_.toCartesianPolyline(frenet_points, cartesian_points);
+}
+
 // /////////////////////////////////////////////////////////////////////////////
 // CorridorSequence
 // /////////////////////////////////////////////////////////////////////////////
 
 BoundaryDistances CorridorSequence::signedDistancesAt(
     const RealType arc_length) const noexcept {
-  auto const_corridor_map_iter = this->get(arc_length);
-  const auto delta_arc_length = arc_length - const_corridor_map_iter->first;
-  return const_corridor_map_iter->second->signedDistancesAt(delta_arc_length);
+  const auto& entry = corridors_[this->get(arc_length)];
+  return entry.second->signedDistancesAt(arc_length - entry.first);
 }
 
 RealType CorridorSequence::widthAt(const RealType arc_length) const noexcept {
-  auto const_corridor_map_iter = this->get(arc_length);
-  const auto delta_arc_length = arc_length - const_corridor_map_iter->first;
-  return const_corridor_map_iter->second->widthAt(delta_arc_length);
+  const auto& entry = corridors_[this->get(arc_length)];
+  return entry.second->widthAt(arc_length - entry.first);
 }
 
 RealType CorridorSequence::centerOffsetAt(
     const RealType arc_length) const noexcept {
-  auto const_corridor_map_iter = this->get(arc_length);
-  const auto delta_arc_length = arc_length - const_corridor_map_iter->first;
-  return const_corridor_map_iter->second->centerOffset(delta_arc_length);
+  const auto& entry = corridors_[this->get(arc_length)];
+  return entry.second->centerOffset(arc_length - entry.first);
 }
 
 RealType CorridorSequence::curvatureAt(
     const RealType arc_length) const noexcept {
-  auto const_corridor_map_iter = this->get(arc_length);
-  const auto delta_arc_length = arc_length - const_corridor_map_iter->first;
-  return const_corridor_map_iter->second->curvatureAt(delta_arc_length);
+  const auto& entry = corridors_[this->get(arc_length)];
+  return entry.second->curvatureAt(arc_length - entry.first);
 }
 
 RealType CorridorSequence::totalLength() const noexcept {
-  return corridor_map_.rbegin()->first /*offset to the last corridor*/ +
-         corridor_map_.rbegin()->second->lengthReferenceLine();
+  return corridors_.back().first /*offset to the last corridor*/ +
+         corridors_.back().second->lengthReferenceLine();
 }
 
 FrenetPositionWithFrame CorridorSequence::getFrenetPositionWithFrame(
     const CartesianPoint2D& position,
     const RealType start_arc_length) const noexcept {
-  CorridorSequenceMap::const_iterator iter = this->get(start_arc_length);
-  return this->getFrenetPositionWithFrame(position, iter);
+  return this->getFrenetPositionWithFrameAt(this->get(start_arc_length),
+                                            position);
 };
 
-FrenetPositionWithFrame CorridorSequence::getFrenetPositionWithFrame(
-    const CartesianPoint2D& position,
-    CorridorSequenceMap::const_iterator iter) const {
+FrenetPositionWithFrame CorridorSequence::getFrenetPositionWithFrameAt(
+    const std::size_t index, const CartesianPoint2D& position) const {
   // Create frenet frame with converted position
   FrenetPositionWithFrame position_with_frame =
-      iter->second->getFrenetPositionWithFrame(position);
+      corridors_[index].second->getFrenetPositionWithFrame(position);
 
   // If position is before current corridor, evaluate previous corridor in
   // the sequence
-  if (position_with_frame.position.l() < 0.0 && iter != corridor_map_.begin()) {
-    iter = std::prev(iter);
-    position_with_frame = this->getFrenetPositionWithFrame(position, iter);
-    return position_with_frame;
+  if (position_with_frame.position.l() < 0.0 && 0 < index) {
+    return this->getFrenetPositionWithFrameAt(index - 1, position);
   }
 
   // If position is behind current corridor, evaluate next corridor in the
   // sequence
-  if (iter->second->lengthReferenceLine() < position_with_frame.position.l() &&
-      std::next(iter) != corridor_map_.end()) {
-    iter = std::next(iter);
-    position_with_frame = this->getFrenetPositionWithFrame(position, iter);
-    return position_with_frame;
+  if (corridors_[index].second->lengthReferenceLine() <
+          position_with_frame.position.l() &&
+      index + 1 < corridors_.size()) {
+    return this->getFrenetPositionWithFrameAt(index + 1, position);
   }
 
   return position_with_frame;
@@ -1,10 +1,15 @@
 #include "corridor/corridor_assignment/corridor_assignment.h"
 
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
 #include "corridor/basic_types.h"
 #include "corridor/cartesian_types.h"
 #include "corridor/corridor.h"
 #include "corridor/corridor_assignment/corridor_related_semantics.h"
 #include "corridor/frenet_types.h"
+#include "corridor/internal/instrumentation.h"
 #include "corridor/internal/math.h"
 
 namespace corridor {
@@ -26,17 +31,20 @@ CorridorRelatedFeatures ComputeCorridorRelatedObjectFeature(
       {relative_orientation, orientation.standard_deviation},
       oriented_bounding_box.length(), oriented_bounding_box.width());
 
-  features.corridor_width =
-      corridor.widthAt(features.frenet_frame.arc_length());
+  // Fused boundary query: width and center offset from one boundary lookup
+  // per side
+  const BoundaryInfo boundary_info =
+      corridor.boundaryInfoAt(features.frenet_frame.arc_length());
+  features.corridor_width = boundary_info.width;
+  features.corridor_center_offset = boundary_info.center_offset;
 
   features.corridor_length = corridor.lengthReferenceLine();
-  features.corridor_center_offset =
-      corridor.centerOffset(features.frenet_frame.arc_length());
 
   return features;
 };
 
 RealType ComputeAssignmentConfidence(const CorridorRelatedFeatures& features) {
+  CORRIDOR_INSTRUMENT_SCOPED_TIMER(kAssignmentConfidenceDurationNs);
   // Resulting likelihood that an object is located on the corridor as the
   // product of the likelihood of each feature.
 
@@ -46,6 +54,208 @@ RealType ComputeAssignmentConfidence(const CorridorRelatedFeatures& features) {
   return latConf * lonConf;
 };
 
+// /////////////////////////////////////////////////////////////////////////////
+// Lazily evaluated features
+// /////////////////////////////////////////////////////////////////////////////
+
+void LazyCorridorRelatedFeatures::ensureProjection() const {
+  if (projection_computed_) {
+    return;
+  }
+  features_.frenet_frame = corridor_.FrenetFrame(cartesian_state_.position());
+  features_.frenet_state =
+      features_.frenet_frame.FromCartesianState(cartesian_state_);
+
+  const UncertainValue orientation = oriented_bounding_box_.orientation();
+  const auto relative_orientation =
+      orientation.value - features_.frenet_frame.frenet_base().orientation;
+  features_.frenet_obb = OrientedBoundingBox(
+      {relative_orientation, orientation.standard_deviation},
+      oriented_bounding_box_.length(), oriented_bounding_box_.width());
+  projection_computed_ = true;
+}
+
+void LazyCorridorRelatedFeatures::ensureBoundary() const {
+  if (boundary_computed_) {
+    return;
+  }
+  // The boundary lookup needs the base arc-length of the projection
+  ensureProjection();
+  const BoundaryInfo boundary_info =
+      corridor_.boundaryInfoAt(features_.frenet_frame.arc_length());
+  features_.corridor_width = boundary_info.width;
+  features_.corridor_center_offset = boundary_info.center_offset;
+  boundary_computed_ = true;
+}
+
+void LazyCorridorRelatedFeatures::ensureLength() const {
+  if (length_computed_) {
+    return;
+  }
+  features_.corridor_length = corridor_.lengthReferenceLine();
+  length_computed_ = true;
+}
+
+const FrenetFrame2D& LazyCorridorRelatedFeatures::frenetFrame() const {
+  ensureProjection();
+  return features_.frenet_frame;
+}
+
+const FrenetState2D& LazyCorridorRelatedFeatures::frenetState() const {
+  ensureProjection();
+  return features_.frenet_state;
+}
+
+const OrientedBoundingBox& LazyCorridorRelatedFeatures::frenetObb() const {
+  ensureProjection();
+  return features_.frenet_obb;
+}
+
+RealType LazyCorridorRelatedFeatures::corridorWidth() const {
+  ensureBoundary();
+  return features_.corridor_width;
+}
+
+RealType LazyCorridorRelatedFeatures::corridorCenterOffset() const {
+  ensureBoundary();
+  return features_.corridor_center_offset;
+}
+
+RealType LazyCorridorRelatedFeatures::corridorLength() const {
+  ensureLength();
+  return features_.corridor_length;
+}
+
+const CorridorRelatedFeatures& LazyCorridorRelatedFeatures::features() const {
+  ensureProjection();
+  ensureBoundary();
+  ensureLength();
+  return features_;
+}
+
+// The lateral confidences need the projection and boundary groups, the
+// longitudinal ones the projection and length groups; each overload
+// materializes exactly those and reuses the struct-based implementation
+RealType LateralAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features) {
+  features.ensureProjection();
+  features.ensureBoundary();
+  return LateralAssignmentConfidence(features.features_);
+}
+
+RealType LeftOfLateralAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features) {
+  features.ensureProjection();
+  features.ensureBoundary();
+  return LeftOfLateralAssignmentConfidence(features.features_);
+}
+
+RealType RightOfLateralAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features) {
+  features.ensureProjection();
+  features.ensureBoundary();
+  return RightOfLateralAssignmentConfidence(features.features_);
+}
+
+RealType LongitudinalAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features) {
+  features.ensureProjection();
+  features.ensureLength();
+  return LongitudinalAssignmentConfidence(features.features_);
+}
+
+RealType DownstreamLongitudinalAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features) {
+  features.ensureProjection();
+  features.ensureLength();
+  return DownstreamLongitudinalAssignmentConfidence(features.features_);
+}
+
+RealType UpstreamLongitudinalAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features) {
+  features.ensureProjection();
+  features.ensureLength();
+  return UpstreamLongitudinalAssignmentConfidence(features.features_);
+}
+
+RealType ComputeAssignmentConfidence(
+    const LazyCorridorRelatedFeatures& features) {
+  return LateralAssignmentConfidence(features) *
+         LongitudinalAssignmentConfidence(features);
+}
+
+// /////////////////////////////////////////////////////////////////////////////
+// Batch assignment engine
+// /////////////////////////////////////////////////////////////////////////////
+
+void AssignObjectsToCorridors(
+    const std::vector<CartesianState2D>& cartesian_states,
+    const std::vector<OrientedBoundingBox>& oriented_bounding_boxes,
+    const CorridorPtrs& corridors, AssignmentConfidenceMatrix* confidences,
+    const std::size_t num_threads) {
+  assert(confidences != nullptr);
+  assert(cartesian_states.size() == oriented_bounding_boxes.size());
+  const auto num_objects = static_cast<Eigen::Index>(cartesian_states.size());
+  const auto num_corridors = static_cast<Eigen::Index>(corridors.size());
+  if (confidences->rows() != num_objects ||
+      confidences->cols() != num_corridors) {
+    confidences->resize(num_objects, num_corridors);
+  }
+  if (num_objects == 0 || num_corridors == 0) {
+    return;
+  }
+
+  // One work unit per corridor: every worker evaluates all objects against
+  // its claimed corridor, so the per-corridor state (reference line, bounds,
+  // length) stays hot in cache and each worker writes one column of the
+  // column-major result matrix
+  const auto evaluate_column = [&cartesian_states, &oriented_bounding_boxes,
+                                &corridors,
+                                confidences](const Eigen::Index column) {
+    const Corridor& corridor = *corridors[column];
+    for (Eigen::Index row = 0;
+         row < static_cast<Eigen::Index>(cartesian_states.size()); row++) {
+      const CorridorRelatedFeatures features =
+          ComputeCorridorRelatedObjectFeature(cartesian_states[row],
+                                              oriented_bounding_boxes[row],
+                                              corridor);
+      (*confidences)(row, column) = ComputeAssignmentConfidence(features);
+    }
+  };
+
+  std::size_t num_workers =
+      (num_threads == 0) ? std::thread::hardware_concurrency() : num_threads;
+  num_workers = std::max<std::size_t>(
+      1, std::min(num_workers, static_cast<std::size_t>(num_corridors)));
+
+  if (num_workers == 1) {
+    for (Eigen::Index column = 0; column < num_corridors; column++) {
+      evaluate_column(column);
+    }
+    return;
+  }
+
+  // Each worker claims the next unevaluated corridor, so unevenly sized
+  // corridors don't stall a static partitioning
+  std::atomic<Eigen::Index> next_column(0);
+  const auto worker = [&evaluate_column, &next_column, num_corridors]() {
+    for (Eigen::Index column = next_column++; column < num_corridors;
+         column = next_column++) {
+      evaluate_column(column);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers - 1);
+  for (std::size_t t = 0; t + 1 < num_workers; t++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
 // /////////////////////////////////////////////////////////////////////////////
 // Lateral and Longitudinal assignment confidences
 // /////////////////////////////////////////////////////////////////////////////
@@ -326,6 +536,185 @@ RealType UpstreamLongitudinalAssignmentConfidence(
   return r1 + r2;
 }
 
+// /////////////////////////////////////////////////////////////////////////////
+// Fused confidence triples
+// /////////////////////////////////////////////////////////////////////////////
+
+namespace {
+
+/**
+ * Standard normal cdf/pdf at one integral bound. The confidence triples
+ * evaluate each bound once and assemble all integrals from the shared
+ * evaluations; the arithmetic mirrors evaluateIntegralLineWidthGaussianErf
+ * exactly, so the fused triples reproduce the individual functions
+ * bit-for-bit.
+ */
+struct GaussBoundEvaluation {
+  RealType cdf;
+  RealType pdf;
+  bool is_nan;
+};
+
+GaussBoundEvaluation EvaluateGaussBound(const RealType x,
+                                        const RealType sigma_original,
+                                        const RealType bound) {
+  const RealType sigma = (sigma_original <= 1e-30) ? (1e-30) : (sigma_original);
+  const RealType tau = (bound - x) / sigma;
+
+  GaussBoundEvaluation evaluation;
+  evaluation.is_nan = std::isnan(tau);
+  if (evaluation.is_nan) {
+    evaluation.cdf = 0.0;
+    evaluation.pdf = 0.0;
+    return evaluation;
+  }
+  constexpr RealType inv_sqrt_2 = M_SQRT1_2;
+  constexpr RealType inv_sqrt_2pi = 0.3989422804014326779399461;
+  evaluation.pdf = inv_sqrt_2pi * std::exp(-0.5 * tau * tau);
+  evaluation.cdf = 0.5 * std::erfc(-tau * inv_sqrt_2);
+  return evaluation;
+}
+
+//! Integral of (m*t + b) times the Gaussian between two pre-evaluated bounds
+inline RealType IntegralBetween(const RealType m, const RealType b,
+                                const RealType x,
+                                const RealType sigma_original,
+                                const GaussBoundEvaluation& lower,
+                                const GaussBoundEvaluation& upper) {
+  if (lower.is_nan || upper.is_nan) {
+    return 0.0;
+  }
+  const RealType sigma = (sigma_original <= 1e-30) ? (1e-30) : (sigma_original);
+  return (m * x + b) * (upper.cdf - lower.cdf) -
+         m * sigma * (upper.pdf - lower.pdf);
+}
+
+}  // namespace
+
+LateralConfidenceTriple LateralAssignmentConfidences(
+    const CorridorRelatedFeatures& features) {
+  // Shared lateral features, derived once for all three confidences
+  const RealType d = features.frenet_state.d();
+  const RealType sigma_d =
+      std::sqrt(features.frenet_state.covarianceMatrix().dd());
+  const RealType object_width = features.frenet_obb.projectionX2();
+  const RealType corridor_width = features.corridor_width;
+  const RealType half_corridor_width = 0.5 * corridor_width;
+  const RealType x = d - features.corridor_center_offset;
+
+  LateralConfidenceTriple triple;
+  if (object_width < std::numeric_limits<RealType>::epsilon()) {
+    // Point-like projection: three flat integrals over four shared bounds
+    const auto far_left = EvaluateGaussBound(x, sigma_d, -100.0);
+    const auto bound_left = EvaluateGaussBound(x, sigma_d, -half_corridor_width);
+    const auto bound_right = EvaluateGaussBound(x, sigma_d, half_corridor_width);
+    const auto far_right = EvaluateGaussBound(x, sigma_d, 100.0);
+    triple.right_of = IntegralBetween(0.0, 1.0, x, sigma_d, far_left, bound_left);
+    triple.inside = IntegralBetween(0.0, 1.0, x, sigma_d, bound_left, bound_right);
+    triple.left_of = IntegralBetween(0.0, 1.0, x, sigma_d, bound_right, far_right);
+    return triple;
+  }
+
+  // Ramp parameters as in the individual confidence functions
+  const RealType m = 1.0 / object_width;
+  const RealType b_inside = 0.5 * (1.0 + corridor_width / object_width);
+  const RealType b_side =
+      (object_width - corridor_width) / (2.0 * object_width);
+
+  const auto far_left = EvaluateGaussBound(x, sigma_d, -100.0);
+  const auto outer_left =
+      EvaluateGaussBound(x, sigma_d, -0.5 * (corridor_width + object_width));
+  const auto inner_left =
+      EvaluateGaussBound(x, sigma_d, -0.5 * (corridor_width - object_width));
+  const auto inner_right =
+      EvaluateGaussBound(x, sigma_d, 0.5 * (corridor_width - object_width));
+  const auto outer_right =
+      EvaluateGaussBound(x, sigma_d, 0.5 * (corridor_width + object_width));
+  const auto far_right = EvaluateGaussBound(x, sigma_d, 100.0);
+
+  if (object_width >= corridor_width) {
+    // Object wider than the corridor: the inside ramps meet at the center
+    const auto center = EvaluateGaussBound(x, sigma_d, 0.0);
+    triple.inside =
+        IntegralBetween(m, b_inside, x, sigma_d, outer_left, center) +
+        IntegralBetween(-m, b_inside, x, sigma_d, center, outer_right);
+  } else {
+    triple.inside =
+        IntegralBetween(m, b_inside, x, sigma_d, outer_left, inner_left) +
+        IntegralBetween(0.0, 1.0, x, sigma_d, inner_left, inner_right) +
+        IntegralBetween(-m, b_inside, x, sigma_d, inner_right, outer_right);
+  }
+  triple.right_of =
+      IntegralBetween(0.0, 1.0, x, sigma_d, far_left, outer_left) +
+      IntegralBetween(-m, b_side, x, sigma_d, outer_left, inner_left);
+  triple.left_of =
+      IntegralBetween(m, b_side, x, sigma_d, inner_right, outer_right) +
+      IntegralBetween(0.0, 1.0, x, sigma_d, outer_right, far_right);
+  return triple;
+}
+
+LongitudinalConfidenceTriple LongitudinalAssignmentConfidences(
+    const CorridorRelatedFeatures& features) {
+  // Shared longitudinal features, derived once for all three confidences
+  const RealType l = features.frenet_state.l();
+  const RealType sigma_l =
+      std::sqrt(features.frenet_state.covarianceMatrix().ll());
+  const RealType object_length = features.frenet_obb.projectionX1();
+  const RealType corridor_length = features.corridor_length;
+
+  LongitudinalConfidenceTriple triple;
+  if (object_length <= std::numeric_limits<RealType>::epsilon()) {
+    // Point-like projection: three flat integrals over four shared bounds
+    const auto far_before = EvaluateGaussBound(l, sigma_l, -100.0);
+    const auto start = EvaluateGaussBound(l, sigma_l, 0.0);
+    const auto end = EvaluateGaussBound(l, sigma_l, corridor_length);
+    const auto far_behind =
+        EvaluateGaussBound(l, sigma_l, corridor_length + 100.0);
+    triple.upstream = IntegralBetween(0.0, 1.0, l, sigma_l, far_before, start);
+    triple.inside = IntegralBetween(0.0, 1.0, l, sigma_l, start, end);
+    triple.downstream = IntegralBetween(0.0, 1.0, l, sigma_l, end, far_behind);
+    return triple;
+  }
+
+  // Ramp parameters as in the individual confidence functions
+  const RealType m1 = 1.0 / object_length;
+  const RealType m2 = -m1;
+  const RealType b1 = 0.5;
+  const RealType b2 = 0.5 + corridor_length / object_length;
+  const RealType b_down = 0.5 - corridor_length / object_length;
+  const RealType half_obj_length = 0.5 * object_length;
+
+  const auto far_before = EvaluateGaussBound(l, sigma_l, -100.0);
+  const auto ramp_in_start = EvaluateGaussBound(l, sigma_l, -half_obj_length);
+  const auto ramp_in_end = EvaluateGaussBound(l, sigma_l, half_obj_length);
+  const auto ramp_out_start =
+      EvaluateGaussBound(l, sigma_l, corridor_length - half_obj_length);
+  const auto ramp_out_end =
+      EvaluateGaussBound(l, sigma_l, corridor_length + half_obj_length);
+  const auto far_behind =
+      EvaluateGaussBound(l, sigma_l, corridor_length + half_obj_length + 100.);
+
+  if (object_length >= corridor_length) {
+    // Object longer than the corridor: the inside ramps meet at the middle
+    const auto middle = EvaluateGaussBound(l, sigma_l, 0.5 * corridor_length);
+    triple.inside =
+        IntegralBetween(m1, b1, l, sigma_l, ramp_in_start, middle) +
+        IntegralBetween(m2, b2, l, sigma_l, middle, ramp_out_end);
+  } else {
+    triple.inside =
+        IntegralBetween(m1, b1, l, sigma_l, ramp_in_start, ramp_in_end) +
+        IntegralBetween(0.0, 1.0, l, sigma_l, ramp_in_end, ramp_out_start) +
+        IntegralBetween(m2, b2, l, sigma_l, ramp_out_start, ramp_out_end);
+  }
+  triple.upstream =
+      IntegralBetween(0.0, 1.0, l, sigma_l, far_before, ramp_in_start) +
+      IntegralBetween(m1, b1, l, sigma_l, ramp_in_start, ramp_in_end);
+  triple.downstream =
+      IntegralBetween(m1, b_down, l, sigma_l, ramp_out_start, ramp_out_end) +
+      IntegralBetween(0.0, 1.0, l, sigma_l, ramp_out_end, far_behind);
+  return triple;
+}
+
 // /////////////////////////////////////////////////////////////////////////////
 // Moving Confidence
 // /////////////////////////////////////////////////////////////////////////////
@@ -362,7 +751,7 @@ RealType RelativeOrientationConfidence(
   // forward/crossing
   // const static RealType delta_phi = M_PI / 64.0;  // ~ 2.8 degrees
   const static RealType delta_phi =
-      std::max(sigma_phi * sigma_band, M_PI / 64.0);
+      std::max(sigma_phi * sigma_band, RealType(M_PI / 64.0));
 
   const RealType denominator = (M_PI - 4 * delta_phi);
   const RealType m = 2.0 / denominator;
@@ -383,4 +772,21 @@ RealType RelativeOrientationConfidence(
   return r1 + r2 + r3;
 }
 
+SemanticLabelSet RelativeDirectionConfidence(
+    const UncertainValue& relative_heading_angle, const RealType sigma_band) {
+  SemanticLabelPairs pairs{
+      {SemanticLabel::kDownstream,
+       RelativeOrientationConfidence(0.0, relative_heading_angle, sigma_band)},
+      {SemanticLabel::kUpstream,
+       RelativeOrientationConfidence(M_PI, relative_heading_angle,
+                                     sigma_band)},
+      {SemanticLabel::kTowardsLeft,
+       RelativeOrientationConfidence(M_PI_2, relative_heading_angle,
+                                     sigma_band)},
+      {SemanticLabel::kTowardsRight,
+       RelativeOrientationConfidence(-M_PI_2, relative_heading_angle,
+                                     sigma_band)}};
+  return SemanticLabelSet(pairs);
+}
+
 }  // namespace corridor
@@ -0,0 +1,73 @@
+#include "corridor/corridor_assignment/corridor_assignment_cache.h"
+
+#include <cmath>
+
+namespace corridor {
+
+const CorridorRelatedFeatures& CorridorAssignmentCache::computeFeatures(
+    const IdType track_id, const CartesianState2D& cartesian_state,
+    const OrientedBoundingBox& oriented_bounding_box,
+    const Corridor& corridor) {
+  const CacheKey key(track_id, corridor.id());
+  const auto iter = entries_.find(key);
+  if (iter == entries_.end()) {
+    // Cold start: full feature computation, cached for the next cycle
+    CacheEntry entry;
+    entry.features = ComputeCorridorRelatedObjectFeature(
+        cartesian_state, oriented_bounding_box, corridor);
+    entry.boundary_arc_length = entry.features.frenet_frame.arc_length();
+    return entries_.emplace(key, entry).first->second.features;
+  }
+
+  CacheEntry& entry = iter->second;
+  CorridorRelatedFeatures& features = entry.features;
+
+  // Revalidate the projection, seeded with the previous base arc-length:
+  // the hint composes with the warm-start candidate selection of the spline
+  const FrenetPositionWithFrame projection =
+      corridor.getFrenetPositionWithFrame(cartesian_state.position(),
+                                          features.frenet_frame.arc_length());
+  features.frenet_frame = projection.frame;
+  features.frenet_state =
+      features.frenet_frame.FromCartesianState(cartesian_state);
+
+  const UncertainValue orientation = oriented_bounding_box.orientation();
+  const auto relative_orientation =
+      orientation.value - features.frenet_frame.frenet_base().orientation;
+  features.frenet_obb = OrientedBoundingBox(
+      {relative_orientation, orientation.standard_deviation},
+      oriented_bounding_box.length(), oriented_bounding_box.width());
+
+  // The corridor length is static and stays cached. Width and center offset
+  // only change with the base arc-length; they are refreshed once the
+  // projection moved more than the threshold since they were computed.
+  const RealType arc_length = features.frenet_frame.arc_length();
+  if (std::abs(arc_length - entry.boundary_arc_length) >
+      arc_length_threshold_) {
+    const BoundaryInfo boundary_info = corridor.boundaryInfoAt(arc_length);
+    features.corridor_width = boundary_info.width;
+    features.corridor_center_offset = boundary_info.center_offset;
+    entry.boundary_arc_length = arc_length;
+  }
+  return features;
+}
+
+RealType CorridorAssignmentCache::computeConfidence(
+    const IdType track_id, const CartesianState2D& cartesian_state,
+    const OrientedBoundingBox& oriented_bounding_box,
+    const Corridor& corridor) {
+  return ComputeAssignmentConfidence(computeFeatures(
+      track_id, cartesian_state, oriented_bounding_box, corridor));
+}
+
+void CorridorAssignmentCache::forgetTrack(const IdType track_id) {
+  for (auto iter = entries_.begin(); iter != entries_.end();) {
+    if (iter->first.first == track_id) {
+      iter = entries_.erase(iter);
+    } else {
+      ++iter;
+    }
+  }
+}
+
+}  // namespace corridor
@@ -0,0 +1,79 @@
+#include "corridor/corridor_builder.h"
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <thread>
+
+#include "corridor/cubic_spline/cubic_spline.h"
+
+namespace corridor {
+
+CorridorPtr BuildCorridor(const CorridorConstructionData& construction_data) {
+  const cubic_spline::CubicSpline reference_line(
+      construction_data.id, construction_data.reference_line_pts);
+
+  // Both boundary conversions project every boundary point onto the (from
+  // here on immutable) reference line and are independent of each other:
+  // convert the left boundary on a second thread, the right one here
+  std::future<FrenetPolyline> left_bound_future = std::async(
+      std::launch::async, [&reference_line, &construction_data]() {
+        return reference_line.toFrenetPolyline(
+            construction_data.left_boundary_pts);
+      });
+  FrenetPolyline right_bound =
+      reference_line.toFrenetPolyline(construction_data.right_boundary_pts);
+
+  return std::make_shared<Corridor>(reference_line, left_bound_future.get(),
+                                    right_bound);
+}
+
+CorridorPtrs BuildCorridors(
+    const CorridorConstructionDataVector& construction_data,
+    const std::size_t num_threads) {
+  CorridorPtrs corridors(construction_data.size());
+  if (construction_data.empty()) {
+    return corridors;
+  }
+
+  std::size_t num_workers =
+      (num_threads == 0) ? std::thread::hardware_concurrency() : num_threads;
+  num_workers = std::max<std::size_t>(
+      1, std::min(num_workers, construction_data.size()));
+
+  if (num_workers == 1) {
+    for (std::size_t i = 0; i < construction_data.size(); i++) {
+      const CorridorConstructionData& data = construction_data[i];
+      corridors[i] = std::make_shared<Corridor>(
+          data.id, data.reference_line_pts, data.left_boundary_pts,
+          data.right_boundary_pts);
+    }
+    return corridors;
+  }
+
+  // Each worker claims the next unbuilt corridor, so unevenly sized
+  // corridors don't stall a static partitioning
+  std::atomic<std::size_t> next_index(0);
+  const auto worker = [&construction_data, &corridors, &next_index]() {
+    for (std::size_t i = next_index++; i < construction_data.size();
+         i = next_index++) {
+      const CorridorConstructionData& data = construction_data[i];
+      corridors[i] = std::make_shared<Corridor>(
+          data.id, data.reference_line_pts, data.left_boundary_pts,
+          data.right_boundary_pts);
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(num_workers - 1);
+  for (std::size_t t = 0; t + 1 < num_workers; t++) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  return corridors;
+}
+
+}  // namespace corridor
@@ -0,0 +1,50 @@
+#include "corridor/corridor_sequence_cursor.h"
+
+#include <cassert>
+#include <limits>
+
+namespace corridor {
+
+FrenetPositionWithFrame CorridorSequenceCursor::project(
+    const CartesianPoint2D& position) {
+  const auto& corridors = sequence_->corridors_;
+  assert(!corridors.empty());
+
+  std::size_t index = (last_match_valid_ && corridor_index_ < corridors.size())
+                          ? corridor_index_
+                          : 0;
+
+  // The last in-corridor arc-length seeds the spline-level candidate
+  // selection on the first attempt; corridor hops fall back to the
+  // unhinted projection
+  RealType arc_length_hint = last_match_valid_
+                                 ? last_arc_length_
+                                 : std::numeric_limits<RealType>::quiet_NaN();
+
+  // Same corridor walk as CorridorSequence::getFrenetPositionWithFrameAt,
+  // but starting at the cursor instead of the sequence front
+  FrenetPositionWithFrame result =
+      corridors[index].second->getFrenetPositionWithFrame(position,
+                                                          arc_length_hint);
+  arc_length_hint = std::numeric_limits<RealType>::quiet_NaN();
+  for (;;) {
+    if (result.position.l() < 0.0 && 0 < index) {
+      index--;
+    } else if (corridors[index].second->lengthReferenceLine() <
+                   result.position.l() &&
+               index + 1 < corridors.size()) {
+      index++;
+    } else {
+      break;
+    }
+    result = corridors[index].second->getFrenetPositionWithFrame(
+        position, arc_length_hint);
+  }
+
+  corridor_index_ = index;
+  last_arc_length_ = result.position.l();
+  last_match_valid_ = true;
+  return result;
+}
+
+}  // namespace corridor
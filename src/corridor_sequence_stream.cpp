@@ -0,0 +1,88 @@
+#include "corridor/corridor_sequence_stream.h"
+
+#include <utility>
+
+namespace corridor {
+
+CorridorSequenceStream::CorridorSequenceStream(
+    CorridorSources sources, const RealType lookahead_distance)
+    : sources_(std::move(sources)),
+      lookahead_distance_(lookahead_distance),
+      horizon_(lookahead_distance) {
+  prefetch_thread_ = std::thread([this]() { prefetchLoop(); });
+}
+
+CorridorSequenceStream::~CorridorSequenceStream() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_ = true;
+  }
+  work_available_.notify_all();
+  prefetch_thread_.join();
+}
+
+void CorridorSequenceStream::prefetchLoop() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    work_available_.wait(lock, [this]() {
+      return stop_ || (next_source_idx_ < sources_.size() &&
+                       constructed_length_ < horizon_);
+    });
+    if (stop_) {
+      return;
+    }
+
+    // Construct outside the lock: this is the expensive spline fit plus two
+    // boundary projections the control loop must not pay for
+    const CorridorSource& source = sources_[next_source_idx_];
+    lock.unlock();
+    CorridorPtr corridor = std::make_shared<Corridor>(
+        source.id, source.reference_line, source.left_boundary,
+        source.right_boundary);
+    const RealType length = corridor->lengthReferenceLine();
+    lock.lock();
+
+    ready_corridors_.push_back(std::move(corridor));
+    next_source_idx_++;
+    constructed_length_ += length;
+    construction_done_.notify_all();
+  }
+}
+
+const CorridorSequence& CorridorSequenceStream::update(
+    const RealType ego_arc_length) {
+  std::vector<CorridorPtr> spliced;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    horizon_ = ego_arc_length + lookahead_distance_;
+    spliced.swap(ready_corridors_);
+    if (next_source_idx_ < sources_.size() &&
+        constructed_length_ < horizon_) {
+      work_available_.notify_one();
+    }
+  }
+  for (const CorridorPtr& corridor : spliced) {
+    sequence_.append(corridor);
+  }
+  return sequence_;
+}
+
+std::size_t CorridorSequenceStream::numConstructed() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return next_source_idx_;
+}
+
+bool CorridorSequenceStream::exhausted() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return next_source_idx_ == sources_.size();
+}
+
+void CorridorSequenceStream::waitForHorizon() const {
+  std::unique_lock<std::mutex> lock(mutex_);
+  construction_done_.wait(lock, [this]() {
+    return next_source_idx_ == sources_.size() ||
+           constructed_length_ >= horizon_;
+  });
+}
+
+}  // namespace corridor
@@ -0,0 +1,171 @@
+#include "corridor/corridor_serialization.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+
+namespace corridor {
+
+namespace {
+
+constexpr char kMagic[8] = {'C', 'O', 'R', 'R', 'B', 'I', 'N', '1'};
+
+struct FileHeader {
+  char magic[8];
+  std::uint64_t corridor_count;
+};
+
+struct CorridorHeader {
+  IdType id;
+  RealType epsilon;
+  std::uint64_t reference_line_cols;
+  std::uint64_t left_bound_cols;
+  std::uint64_t right_bound_cols;
+};
+
+void WritePolyline(std::ofstream& file, const FrenetPolyline& polyline) {
+  for (int idx = 0, size = polyline.size(); idx < size; idx++) {
+    const FrenetPoint2D point = polyline.GetPoint(idx);
+    const RealType values[2] = {point.l(), point.d()};
+    file.write(reinterpret_cast<const char*>(values), sizeof(values));
+  }
+}
+
+}  // namespace
+
+bool WriteCorridorsToBinaryFile(const CorridorPtrs& corridors,
+                                const std::string& filename) {
+  std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+  if (!file.is_open()) {
+    return false;
+  }
+
+  FileHeader file_header;
+  std::memcpy(file_header.magic, kMagic, sizeof(kMagic));
+  file_header.corridor_count = corridors.size();
+  file.write(reinterpret_cast<const char*>(&file_header), sizeof(file_header));
+
+  for (const CorridorPtr& corridor : corridors) {
+    if (corridor == nullptr) {
+      return false;
+    }
+    const auto& reference_line = corridor->referenceLine();
+    const auto& spline_data = reference_line.GetData();
+
+    CorridorHeader corridor_header;
+    corridor_header.id = reference_line.GetId();
+    corridor_header.epsilon = reference_line.GetEpsilon();
+    corridor_header.reference_line_cols =
+        static_cast<std::uint64_t>(spline_data.cols());
+    corridor_header.left_bound_cols =
+        static_cast<std::uint64_t>(corridor->leftBound().size());
+    corridor_header.right_bound_cols =
+        static_cast<std::uint64_t>(corridor->rightBound().size());
+    file.write(reinterpret_cast<const char*>(&corridor_header),
+               sizeof(corridor_header));
+
+    // Raw column-major values, exactly as the Eigen matrices hold them
+    file.write(reinterpret_cast<const char*>(spline_data.data()),
+               static_cast<std::streamsize>(sizeof(RealType) *
+                                            spline_data.size()));
+    WritePolyline(file, corridor->leftBound());
+    WritePolyline(file, corridor->rightBound());
+  }
+  return file.good();
+}
+
+CorridorPtrs LoadCorridorsFromBinaryFile(const std::string& filename) {
+  CorridorPtrs corridors;
+
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return corridors;
+  }
+  struct stat file_stat;
+  if (::fstat(fd, &file_stat) != 0 ||
+      static_cast<std::size_t>(file_stat.st_size) < sizeof(FileHeader)) {
+    ::close(fd);
+    return corridors;
+  }
+  const std::size_t file_size = static_cast<std::size_t>(file_stat.st_size);
+  void* mapping = ::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapping == MAP_FAILED) {
+    return corridors;
+  }
+  const char* file_data = static_cast<const char*>(mapping);
+
+  std::size_t offset = 0;
+  const auto contains = [&offset, file_size](const std::size_t num_bytes) {
+    return offset + num_bytes <= file_size;
+  };
+
+  FileHeader file_header;
+  std::memcpy(&file_header, file_data, sizeof(file_header));
+  offset += sizeof(file_header);
+  if (std::memcmp(file_header.magic, kMagic, sizeof(kMagic)) != 0) {
+    ::munmap(mapping, file_size);
+    return corridors;
+  }
+
+  bool valid = true;
+  for (std::uint64_t i = 0; i < file_header.corridor_count; i++) {
+    if (!contains(sizeof(CorridorHeader))) {
+      valid = false;
+      break;
+    }
+    CorridorHeader corridor_header;
+    std::memcpy(&corridor_header, file_data + offset, sizeof(corridor_header));
+    offset += sizeof(corridor_header);
+
+    const std::size_t spline_bytes =
+        sizeof(RealType) * cubic_spline::BasicDataTypes::kSize *
+        corridor_header.reference_line_cols;
+    const std::size_t left_bytes = sizeof(RealType) *
+                                   FrenetPolyline::DataType::kSize *
+                                   corridor_header.left_bound_cols;
+    const std::size_t right_bytes = sizeof(RealType) *
+                                    FrenetPolyline::DataType::kSize *
+                                    corridor_header.right_bound_cols;
+    if (!contains(spline_bytes + left_bytes + right_bytes)) {
+      valid = false;
+      break;
+    }
+
+    // Adopt the matrices directly from the mapping, no parsing involved
+    const Eigen::Map<const cubic_spline::DataMatrix<RealType>> spline_data(
+        reinterpret_cast<const RealType*>(file_data + offset),
+        cubic_spline::BasicDataTypes::kSize,
+        static_cast<Eigen::Index>(corridor_header.reference_line_cols));
+    offset += spline_bytes;
+    const Eigen::Map<const FrenetPolyline::DataMatrix> left_bound_data(
+        reinterpret_cast<const RealType*>(file_data + offset),
+        FrenetPolyline::DataType::kSize,
+        static_cast<Eigen::Index>(corridor_header.left_bound_cols));
+    offset += left_bytes;
+    const Eigen::Map<const FrenetPolyline::DataMatrix> right_bound_data(
+        reinterpret_cast<const RealType*>(file_data + offset),
+        FrenetPolyline::DataType::kSize,
+        static_cast<Eigen::Index>(corridor_header.right_bound_cols));
+    offset += right_bytes;
+
+    corridors.emplace_back(std::make_shared<Corridor>(
+        cubic_spline::CubicSpline(corridor_header.id, spline_data,
+                                  corridor_header.epsilon),
+        FrenetPolyline(FrenetPolyline::DataMatrix(left_bound_data)),
+        FrenetPolyline(FrenetPolyline::DataMatrix(right_bound_data))));
+  }
+
+  ::munmap(mapping, file_size);
+  if (!valid) {
+    corridors.clear();
+  }
+  return corridors;
+}
+
+}  // namespace corridor
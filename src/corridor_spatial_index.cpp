@@ -0,0 +1,121 @@
+#include "corridor/corridor_spatial_index.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace corridor {
+
+namespace {
+
+//! Sampling distance of the boundary polylines used for the bounding boxes.
+//! Coarse sampling is sufficient since the boxes are padded by the margin.
+constexpr RealType kBoundingBoxSamplingDistance = 1.0;
+
+}  // namespace
+
+void CorridorSpatialIndex::build(const CorridorPtrs& corridors,
+                                 const RealType cell_size,
+                                 const RealType margin) {
+  clear();
+  if (corridors.empty() || cell_size <= 0.0) {
+    return;
+  }
+  corridors_ = corridors;
+
+  // Bounding box per corridor from the sampled boundary polylines
+  bounding_boxes_.reserve(corridors_.size());
+  CartesianPoints2D reference_polyline, left_polyline, right_polyline;
+  for (const CorridorPtr& corridor : corridors_) {
+    BoundingBox box{std::numeric_limits<RealType>::max(),
+                    std::numeric_limits<RealType>::max(),
+                    std::numeric_limits<RealType>::lowest(),
+                    std::numeric_limits<RealType>::lowest()};
+    corridor->fillCartesianPolylines(&reference_polyline, &left_polyline,
+                                     &right_polyline,
+                                     kBoundingBoxSamplingDistance);
+    for (const CartesianPoints2D* polyline : {&left_polyline, &right_polyline}) {
+      for (const CartesianPoint2D& point : *polyline) {
+        box.min_x = std::min(box.min_x, point.x());
+        box.min_y = std::min(box.min_y, point.y());
+        box.max_x = std::max(box.max_x, point.x());
+        box.max_y = std::max(box.max_y, point.y());
+      }
+    }
+    box.min_x -= margin;
+    box.min_y -= margin;
+    box.max_x += margin;
+    box.max_y += margin;
+    bounding_boxes_.emplace_back(box);
+  }
+
+  // Grid over the union of all bounding boxes
+  origin_x_ = std::numeric_limits<RealType>::max();
+  origin_y_ = std::numeric_limits<RealType>::max();
+  RealType max_x = std::numeric_limits<RealType>::lowest();
+  RealType max_y = std::numeric_limits<RealType>::lowest();
+  for (const BoundingBox& box : bounding_boxes_) {
+    origin_x_ = std::min(origin_x_, box.min_x);
+    origin_y_ = std::min(origin_y_, box.min_y);
+    max_x = std::max(max_x, box.max_x);
+    max_y = std::max(max_y, box.max_y);
+  }
+  inv_cell_size_ = 1.0 / cell_size;
+  num_cells_x_ = static_cast<std::size_t>(
+                     std::floor((max_x - origin_x_) * inv_cell_size_)) +
+                 1;
+  num_cells_y_ = static_cast<std::size_t>(
+                     std::floor((max_y - origin_y_) * inv_cell_size_)) +
+                 1;
+  cells_.resize(num_cells_x_ * num_cells_y_);
+
+  // Register each corridor in every cell its bounding box intersects
+  for (std::size_t corridor_idx = 0; corridor_idx < bounding_boxes_.size();
+       corridor_idx++) {
+    const BoundingBox& box = bounding_boxes_[corridor_idx];
+    const auto first_cell_x = static_cast<std::size_t>(
+        std::floor((box.min_x - origin_x_) * inv_cell_size_));
+    const auto first_cell_y = static_cast<std::size_t>(
+        std::floor((box.min_y - origin_y_) * inv_cell_size_));
+    const auto last_cell_x = static_cast<std::size_t>(
+        std::floor((box.max_x - origin_x_) * inv_cell_size_));
+    const auto last_cell_y = static_cast<std::size_t>(
+        std::floor((box.max_y - origin_y_) * inv_cell_size_));
+    for (std::size_t cell_y = first_cell_y; cell_y <= last_cell_y; cell_y++) {
+      for (std::size_t cell_x = first_cell_x; cell_x <= last_cell_x;
+           cell_x++) {
+        cells_[cell_y * num_cells_x_ + cell_x].emplace_back(corridor_idx);
+      }
+    }
+  }
+}
+
+CorridorPtrs CorridorSpatialIndex::corridorCandidatesAt(
+    const CartesianPoint2D& point) const {
+  CorridorPtrs candidates;
+  if (cells_.empty()) {
+    return candidates;
+  }
+
+  const RealType cell_x_value = (point.x() - origin_x_) * inv_cell_size_;
+  const RealType cell_y_value = (point.y() - origin_y_) * inv_cell_size_;
+  if (cell_x_value < 0.0 || cell_y_value < 0.0) {
+    // Point outside of the indexed region
+    return candidates;
+  }
+  const auto cell_x = static_cast<std::size_t>(std::floor(cell_x_value));
+  const auto cell_y = static_cast<std::size_t>(std::floor(cell_y_value));
+  if (num_cells_x_ <= cell_x || num_cells_y_ <= cell_y) {
+    return candidates;
+  }
+
+  for (const std::size_t corridor_idx :
+       cells_[cell_y * num_cells_x_ + cell_x]) {
+    if (bounding_boxes_[corridor_idx].contains(point)) {
+      candidates.emplace_back(corridors_[corridor_idx]);
+    }
+  }
+  return candidates;
+}
+
+}  // namespace corridor
@@ -3,13 +3,15 @@
 #include <limits>
 
 #include "corridor/cubic_spline/cubic_spline_coefficients.h"
+#include "corridor/cubic_spline/cubic_spline_utilities.h"
 
 namespace corridor {
 
 namespace cubic_spline {
 
-using DynamicMatrix = Eigen::Matrix<RealType, Eigen::Dynamic, Eigen::Dynamic>;
-using DynamicColumnVector = Eigen::Matrix<RealType, Eigen::Dynamic, 1>;
+// Moment systems are assembled and solved in SolverRealType (double), also
+// in single precision builds; see basic_types.h
+using DynamicColumnVector = Eigen::Matrix<SolverRealType, Eigen::Dynamic, 1>;
 
 // /////////////////////////////////////////////////////////////////////////////
 // Derive Spline coefficients from spline data matrix
@@ -26,39 +28,76 @@ SplineCoefficients2d SplineCoefficientsFromDataMatrix(
 }
 
 // /////////////////////////////////////////////////////////////////////////////
-// Natural Spline functions
+// Tridiagonal (Thomas algorithm) solver
 // /////////////////////////////////////////////////////////////////////////////
 
-DynamicMatrix NaturalSplineMatrixM(const DataRow<RealType>& arc_lengths) {
-  const auto size = arc_lengths.cols();
-  DynamicMatrix matrix_M;
-  matrix_M.resize(size, size);
-  matrix_M.setZero();
-  for (DataIdx i = 1, max_idx = size - 1; i < max_idx; i++) {
-    const auto delta_arc_length_1 = arc_lengths(i) - arc_lengths(i - 1);
-    const auto delta_arc_length_2 = arc_lengths(i + 1) - arc_lengths(i);
-    matrix_M(i, i - 1) = delta_arc_length_1;
-    matrix_M(i, i) = 2.f * (delta_arc_length_1 + delta_arc_length_2);
-    matrix_M(i, i + 1) = delta_arc_length_2;
+/**
+ * @brief Solves a tridiagonal linear system with the Thomas algorithm in O(n)
+ *        time and memory. The moment systems of both the natural and the
+ *        clamped spline are strictly tridiagonal, so a dense solve is never
+ *        required.
+ *
+ * @param lower: sub-diagonal (first element unused)
+ * @param diag: main diagonal
+ * @param upper: super-diagonal (last element unused)
+ * @param rhs: right-hand side of the system
+ * @return DynamicColumnVector: solution vector
+ */
+DynamicColumnVector SolveTridiagonalSystem(const DynamicColumnVector& lower,
+                                           const DynamicColumnVector& diag,
+                                           const DynamicColumnVector& upper,
+                                           const DynamicColumnVector& rhs) {
+  const auto size = diag.rows();
+  DynamicColumnVector scratch(size);
+  DynamicColumnVector solution(size);
+
+  // Forward sweep
+  scratch(0) = upper(0) / diag(0);
+  solution(0) = rhs(0) / diag(0);
+  for (DataIdx i = 1; i < size; i++) {
+    const SolverRealType denominator = diag(i) - lower(i) * scratch(i - 1);
+    if (i < size - 1) {
+      scratch(i) = upper(i) / denominator;
+    }
+    solution(i) = (rhs(i) - lower(i) * solution(i - 1)) / denominator;
   }
-  matrix_M(0, 0) = 1.0;
-  matrix_M(size - 1, size - 1) = 1.0;
-  return matrix_M;
+
+  // Back substitution
+  for (DataIdx i = size - 2; 0 <= i; i--) {
+    solution(i) -= scratch(i) * solution(i + 1);
+  }
+  return solution;
 }
 
-DynamicMatrix NaturalSplineMatrixL(const DataRow<RealType>& arc_lengths) {
+// /////////////////////////////////////////////////////////////////////////////
+// Natural Spline functions
+// /////////////////////////////////////////////////////////////////////////////
+
+DynamicColumnVector NaturalSplineMoments(const DataRow<RealType>& arc_lengths,
+                                         const DataRow<RealType>& values) {
   const auto size = arc_lengths.cols();
-  DynamicMatrix matrix_L;
-  matrix_L.resize(size, size);
-  matrix_L.setZero();
+  DynamicColumnVector lower(size), diag(size), upper(size), rhs(size);
+
+  // Inner rows of the moment system
   for (DataIdx i = 1, max_idx = size - 1; i < max_idx; i++) {
     const auto delta_arc_length_1 = arc_lengths(i) - arc_lengths(i - 1);
     const auto delta_arc_length_2 = arc_lengths(i + 1) - arc_lengths(i);
-    matrix_L(i, i - 1) = 6.f / delta_arc_length_1;
-    matrix_L(i, i) = (-6.f / delta_arc_length_1) + (-6.f / delta_arc_length_2);
-    matrix_L(i, i + 1) = 6.f / delta_arc_length_2;
+    lower(i) = delta_arc_length_1;
+    diag(i) = 2.f * (delta_arc_length_1 + delta_arc_length_2);
+    upper(i) = delta_arc_length_2;
+    rhs(i) = 6.f * ((values(i + 1) - values(i)) / delta_arc_length_2 -
+                    (values(i) - values(i - 1)) / delta_arc_length_1);
   }
-  return matrix_L;
+
+  // Natural boundary conditions: zero curvature at the end points
+  diag(0) = 1.0;
+  upper(0) = 0.0;
+  rhs(0) = 0.0;
+  diag(size - 1) = 1.0;
+  lower(size - 1) = 0.0;
+  rhs(size - 1) = 0.0;
+
+  return SolveTridiagonalSystem(lower, diag, upper, rhs);
 }
 
 // /////////////////////////////////////////////////////////////////////////////
@@ -86,21 +125,15 @@ void ArcLengthApproximation(DataMatrix<RealType>& data,
   data(kArcLength, data.cols() - 1) = accumulated_arc_length;
 }
 
-DataMatrix<RealType> NaturalSplineDataMatrixFromPoints(
-    const CartesianPoints2D& cartesian_points, const RealType epsilon) {
-  // 1) Check integrity of points
-  const auto pts_size = cartesian_points.size();
-  assert(pts_size > 1);
-
-  // Create spline data matrix which will be filled below
-  DataMatrix<RealType> data;
-  data.resize(BasicDataTypes::kSize, static_cast<Eigen::Index>(pts_size));
-
-  // Add points to data matrix
-  for (std::size_t i = 0; i < pts_size; i++) {
-    data.block<2, 1>(kPoint_x, static_cast<DataIdx>(i)) = cartesian_points[i];
-  }
+namespace {
 
+/**
+ * @brief Natural spline fit on a data matrix whose point rows are already
+ *        filled: initial chord-length parametrization plus the moment and
+ *        arc-length approximation loop. Shared by the owning and the
+ *        zero-copy (view) entry points.
+ */
+void FitNaturalSplineData(DataMatrix<RealType>& data, const RealType epsilon) {
   // Initial arc-length calculation
   RealType accumulated_arc_length = 0.f;
   for (DataIdx idx = 0, max = data.cols() - 1; idx < max; idx++) {
@@ -114,15 +147,13 @@ DataMatrix<RealType> NaturalSplineDataMatrixFromPoints(
   RealType delta_arc_length = 0.f;
   // Approximation loop for moments and arc-length
   for (int counter = 0; counter < 10; counter++) {
-    DynamicMatrix matrixM = NaturalSplineMatrixM(data.row(kArcLength));
-    DynamicMatrix matrixL = NaturalSplineMatrixL(data.row(kArcLength));
-
-    // Define Moments
-    Eigen::FullPivLU<DynamicMatrix> full_piv_lu(matrixM);
-    data.row(kMoment_x) = full_piv_lu.solve(
-        matrixL * static_cast<DynamicColumnVector>(data.row(kPoint_x)));
-    data.row(kMoment_y) = full_piv_lu.solve(
-        matrixL * static_cast<DynamicColumnVector>(data.row(kPoint_y)));
+    // Define Moments: O(n) tridiagonal solve per coordinate
+    data.row(kMoment_x) =
+        NaturalSplineMoments(data.row(kArcLength), data.row(kPoint_x))
+            .cast<RealType>();
+    data.row(kMoment_y) =
+        NaturalSplineMoments(data.row(kArcLength), data.row(kPoint_y))
+            .cast<RealType>();
 
     // Define Coefficients
     SplineCoefficients2d coefficients = SplineCoefficientsFromDataMatrix(data);
@@ -135,66 +166,201 @@ DataMatrix<RealType> NaturalSplineDataMatrixFromPoints(
       break;
     }
   }
+
+  // Node tangents never change after fitting; store them once so projection
+  // queries don't have to re-derive them from the segment coefficients.
+  data.middleRows<2>(kTangent_x) = TangentsOnNodes(data);
+}
+
+}  // namespace
+
+DataMatrix<RealType> NaturalSplineDataMatrixFromPoints(
+    const CartesianPoints2D& cartesian_points, const RealType epsilon) {
+  // 1) Check integrity of points
+  const auto pts_size = cartesian_points.size();
+  assert(pts_size > 1);
+
+  // Create spline data matrix which will be filled below
+  DataMatrix<RealType> data;
+  data.resize(BasicDataTypes::kSize, static_cast<Eigen::Index>(pts_size));
+
+  // Add points to data matrix
+  for (std::size_t i = 0; i < pts_size; i++) {
+    data.block<2, 1>(kPoint_x, static_cast<DataIdx>(i)) = cartesian_points[i];
+  }
+
+  FitNaturalSplineData(data, epsilon);
+  return data;
+}
+
+DataMatrix<RealType> NaturalSplineDataMatrixFromPoints(
+    const CartesianPointsView2D& cartesian_points, const RealType epsilon) {
+  // 1) Check integrity of points
+  assert(cartesian_points.cols() > 1);
+
+  // Create spline data matrix which will be filled below
+  DataMatrix<RealType> data;
+  data.resize(BasicDataTypes::kSize, cartesian_points.cols());
+
+  // Copy the points as one block straight from the external buffer; this is
+  // the only copy on the zero-copy construction path
+  data.middleRows<2>(kPoint_x) = cartesian_points;
+
+  FitNaturalSplineData(data, epsilon);
   return data;
 }
 
 // /////////////////////////////////////////////////////////////////////////////
-// Clamped Spline functions
+// Incremental spline extension
 // /////////////////////////////////////////////////////////////////////////////
 
-DynamicMatrix ClampedSplineMatrixM(const DataRow<RealType>& arc_lengths) {
+/**
+ * @brief Moment system of a trailing spline window: the moment of the first
+ *        window node is pinned to its value from the previous fit, the last
+ *        node gets the natural (curvature free) end condition.
+ */
+DynamicColumnVector PinnedStartSplineMoments(
+    const DataRow<RealType>& arc_lengths, const DataRow<RealType>& values,
+    const RealType first_moment) {
   const auto size = arc_lengths.cols();
-  DynamicMatrix matrix_M;
-  matrix_M.resize(size, size);
-  matrix_M.setZero();
+  DynamicColumnVector lower(size), diag(size), upper(size), rhs(size);
+
+  // Inner rows of the moment system
   for (DataIdx i = 1, max_idx = size - 1; i < max_idx; i++) {
     const auto delta_arc_length_1 = arc_lengths(i) - arc_lengths(i - 1);
     const auto delta_arc_length_2 = arc_lengths(i + 1) - arc_lengths(i);
-    matrix_M(i, i - 1) = delta_arc_length_1;
-    matrix_M(i, i) = 2.f * (delta_arc_length_1 + delta_arc_length_2);
-    matrix_M(i, i + 1) = delta_arc_length_2;
+    lower(i) = delta_arc_length_1;
+    diag(i) = 2.f * (delta_arc_length_1 + delta_arc_length_2);
+    upper(i) = delta_arc_length_2;
+    rhs(i) = 6.f * ((values(i + 1) - values(i)) / delta_arc_length_2 -
+                    (values(i) - values(i - 1)) / delta_arc_length_1);
   }
 
-  // Set first and last row specifically for the clamped constraints
-  const auto first_delta_l = arc_lengths(1) - arc_lengths(0);
-  matrix_M(0, 0) = 2 * first_delta_l;
-  matrix_M(0, 1) = first_delta_l;
+  // Pinned moment at the window start, natural end condition
+  diag(0) = 1.0;
+  upper(0) = 0.0;
+  rhs(0) = first_moment;
+  diag(size - 1) = 1.0;
+  lower(size - 1) = 0.0;
+  rhs(size - 1) = 0.0;
 
-  const auto last_delta_l = arc_lengths(size - 1) - arc_lengths(size - 2);
-  matrix_M(size - 1, size - 1) = 2 * last_delta_l;
-  matrix_M(size - 1, size - 2) = last_delta_l;
-  return matrix_M;
+  return SolveTridiagonalSystem(lower, diag, upper, rhs);
+}
+
+DataMatrix<RealType> AppendToSplineDataMatrix(
+    const DataMatrix<RealType>& data, const CartesianPoints2D& new_points,
+    const RealType epsilon) {
+  assert(data.cols() >= 2);
+  if (new_points.empty()) {
+    return data;
+  }
+
+  // Number of trailing nodes which are refitted together with the new points.
+  // The moment perturbation of an appended point decays roughly by a factor
+  // of four per node towards the spline start, so after this window it is
+  // well below the arc-length approximation accuracy.
+  constexpr DataIdx kMomentWindow = 8;
+
+  const DataIdx old_size = data.cols();
+  const DataIdx pinned_idx = old_size - 1 - kMomentWindow;
+  if (pinned_idx <= 0) {
+    // Spline shorter than the window: full refit is just as cheap
+    CartesianPoints2D points;
+    for (DataIdx idx = 0; idx < old_size; idx++) {
+      points.emplace_back(data(kPoint_x, idx), data(kPoint_y, idx));
+    }
+    points.insert(points.end(), new_points.begin(), new_points.end());
+    return NaturalSplineDataMatrixFromPoints(points, epsilon);
+  }
+
+  // Assemble the window data matrix: trailing nodes plus the new points, with
+  // arc-lengths relative to the pinned node
+  const auto window_size =
+      (old_size - pinned_idx) + static_cast<DataIdx>(new_points.size());
+  DataMatrix<RealType> window;
+  window.resize(BasicDataTypes::kSize, window_size);
+  window.leftCols(old_size - pinned_idx) = data.rightCols(old_size - pinned_idx);
+  const RealType pinned_arc_length = data(kArcLength, pinned_idx);
+  window.row(kArcLength).head(old_size - pinned_idx).array() -=
+      pinned_arc_length;
+  for (std::size_t i = 0; i < new_points.size(); i++) {
+    const DataIdx idx = (old_size - pinned_idx) + static_cast<DataIdx>(i);
+    window.block<2, 1>(kPoint_x, idx) = new_points[i];
+    const DataPoint<RealType>& p1 = window.block<2, 1>(kPoint_x, idx - 1);
+    const DataPoint<RealType>& p2 = window.block<2, 1>(kPoint_x, idx);
+    window(kArcLength, idx) = window(kArcLength, idx - 1) + ChordLength(p1, p2);
+  }
+
+  const RealType pinned_moment_x = data(kMoment_x, pinned_idx);
+  const RealType pinned_moment_y = data(kMoment_y, pinned_idx);
+
+  RealType delta_arc_length = 0.f;
+  // Approximation loop for moments and arc-length, restricted to the window
+  for (int counter = 0; counter < 10; counter++) {
+    window.row(kMoment_x) =
+        PinnedStartSplineMoments(window.row(kArcLength), window.row(kPoint_x),
+                                 pinned_moment_x)
+            .cast<RealType>();
+    window.row(kMoment_y) =
+        PinnedStartSplineMoments(window.row(kArcLength), window.row(kPoint_y),
+                                 pinned_moment_y)
+            .cast<RealType>();
+
+    SplineCoefficients2d coefficients = SplineCoefficientsFromDataMatrix(window);
+
+    delta_arc_length = window(kArcLength, window.cols() - 1);
+    ArcLengthApproximation(window, coefficients);
+    delta_arc_length -= window(kArcLength, window.cols() - 1);
+    if (abs(delta_arc_length) < epsilon) {
+      break;
+    }
+  }
+  window.middleRows<2>(kTangent_x) = TangentsOnNodes(window);
+
+  // Splice the refitted window behind the untouched nodes
+  DataMatrix<RealType> extended;
+  extended.resize(BasicDataTypes::kSize, pinned_idx + window_size);
+  extended.leftCols(pinned_idx) = data.leftCols(pinned_idx);
+  extended.rightCols(window_size) = window;
+  extended.row(kArcLength).tail(window_size).array() += pinned_arc_length;
+  return extended;
 }
 
-DynamicMatrix ClampedSplineMatrixL(const DataRow<RealType>& arc_lengths) {
-  const auto row_size = arc_lengths.cols();
-  const auto col_size = row_size + 2;
-  DynamicMatrix matrix_L;
-  matrix_L.resize(row_size,
-                  col_size);  // two additional columns for the tangent
-  matrix_L.setZero();
-  for (DataIdx i = 1, max_idx = row_size - 1; i < max_idx; i++) {
+// /////////////////////////////////////////////////////////////////////////////
+// Clamped Spline functions
+// /////////////////////////////////////////////////////////////////////////////
+
+DynamicColumnVector ClampedSplineMoments(const DataRow<RealType>& arc_lengths,
+                                         const DataRow<RealType>& values,
+                                         const RealType first_tangent,
+                                         const RealType last_tangent) {
+  const auto size = arc_lengths.cols();
+  DynamicColumnVector lower(size), diag(size), upper(size), rhs(size);
+
+  // Inner rows of the moment system
+  for (DataIdx i = 1, max_idx = size - 1; i < max_idx; i++) {
     const auto delta_arc_length_1 = arc_lengths(i) - arc_lengths(i - 1);
     const auto delta_arc_length_2 = arc_lengths(i + 1) - arc_lengths(i);
-    matrix_L(i, i) = 6.f / delta_arc_length_1;
-    matrix_L(i, i + 1) =
-        (-6.f / delta_arc_length_1) + (-6.f / delta_arc_length_2);
-    matrix_L(i, i + 2) = 6.f / delta_arc_length_2;
+    lower(i) = delta_arc_length_1;
+    diag(i) = 2.f * (delta_arc_length_1 + delta_arc_length_2);
+    upper(i) = delta_arc_length_2;
+    rhs(i) = 6.f * ((values(i + 1) - values(i)) / delta_arc_length_2 -
+                    (values(i) - values(i - 1)) / delta_arc_length_1);
   }
 
   // Set first and last row specifically for the clamped constraints
   const auto first_delta_l = arc_lengths(1) - arc_lengths(0);
-  matrix_L(0, 0) = -6.0;
-  matrix_L(0, 1) = -6.0 / first_delta_l;
-  matrix_L(0, 2) = 6.0 / first_delta_l;
+  diag(0) = 2 * first_delta_l;
+  upper(0) = first_delta_l;
+  rhs(0) = 6.f * ((values(1) - values(0)) / first_delta_l - first_tangent);
 
-  const auto last_delta_l =
-      arc_lengths(row_size - 1) - arc_lengths(row_size - 2);
-  matrix_L(row_size - 1, col_size - 1) = 6.0;
-  matrix_L(row_size - 1, col_size - 2) = -6.0 / last_delta_l;
-  matrix_L(row_size - 1, col_size - 3) = 6.0 / last_delta_l;
+  const auto last_delta_l = arc_lengths(size - 1) - arc_lengths(size - 2);
+  diag(size - 1) = 2 * last_delta_l;
+  lower(size - 1) = last_delta_l;
+  rhs(size - 1) =
+      6.f * (last_tangent - (values(size - 1) - values(size - 2)) / last_delta_l);
 
-  return matrix_L;
+  return SolveTridiagonalSystem(lower, diag, upper, rhs);
 }
 
 DataMatrix<RealType> ClampedSplineDataMatrixFromPoints(
@@ -227,21 +393,16 @@ DataMatrix<RealType> ClampedSplineDataMatrixFromPoints(
   RealType delta_arc_length = 0.f;
   // Approximation loop for moments and arc-length
   for (int counter = 0; counter < 10; counter++) {
-    DynamicMatrix matrixM = ClampedSplineMatrixM(data.row(kArcLength));
-    DynamicMatrix matrixL = ClampedSplineMatrixL(data.row(kArcLength));
-
-    // Augmented support point vectors with tangent data
-    DynamicColumnVector aug_pts_x(pts_size + 2);
-    aug_pts_x << first_tangent.x(),
-        static_cast<DynamicColumnVector>(data.row(kPoint_x)), last_tangent.x();
-    DynamicColumnVector aug_pts_y(pts_size + 2);
-    aug_pts_y << first_tangent.y(),
-        static_cast<DynamicColumnVector>(data.row(kPoint_y)), last_tangent.y();
-
-    // Define Moments
-    Eigen::FullPivLU<DynamicMatrix> full_piv_lu(matrixM);
-    data.row(kMoment_x) = full_piv_lu.solve(matrixL * aug_pts_x);
-    data.row(kMoment_y) = full_piv_lu.solve(matrixL * aug_pts_y);
+    // Define Moments: O(n) tridiagonal solve per coordinate, with the tangent
+    // data entering the right-hand side of the first and last row
+    data.row(kMoment_x) =
+        ClampedSplineMoments(data.row(kArcLength), data.row(kPoint_x),
+                             first_tangent.x(), last_tangent.x())
+            .cast<RealType>();
+    data.row(kMoment_y) =
+        ClampedSplineMoments(data.row(kArcLength), data.row(kPoint_y),
+                             first_tangent.y(), last_tangent.y())
+            .cast<RealType>();
 
     // Define Coefficients
     SplineCoefficients2d coefficients = SplineCoefficientsFromDataMatrix(data);
@@ -256,6 +417,10 @@ DataMatrix<RealType> ClampedSplineDataMatrixFromPoints(
       break;
     }
   }
+
+  // Node tangents never change after fitting; store them once so projection
+  // queries don't have to re-derive them from the segment coefficients.
+  data.middleRows<2>(kTangent_x) = TangentsOnNodes(data);
   return data;
 }
 
@@ -1,10 +1,13 @@
 #include "corridor/cubic_spline/cubic_spline.h"
 
+#include <algorithm>
 #include <cmath>
 #include <iostream>
+#include <numeric>
 
 #include "corridor/cubic_spline/cubic_interpolation_2d.h"
 #include "corridor/cubic_spline/cubic_spline_utilities.h"
+#include "corridor/internal/instrumentation.h"
 
 using namespace corridor;
 using namespace cubic_spline;
@@ -21,64 +24,112 @@ bool CubicSpline::constructSplineData(const std::vector<RealType>& x_vec,
 
   // Natural spline
   data_ = NaturalSplineDataMatrixFromPoints(points, epsilon_);
+  coefficients_ = SplineCoefficientsFromDataMatrix(data_);
+  arc_length_index_.build(data_.row(kArcLength));
   return true;
 }
 
-bool CubicSpline::constructSplineData(const CartesianPoints2D& points) {
+bool CubicSpline::constructSplineData(const CartesianPoints2D& points,
+                                      const bool decimate_points) {
   if (points.size() < 2) {
     return false;
   }
   // Natural spline
+  data_ = NaturalSplineDataMatrixFromPoints(
+      decimate_points ? DecimatePoints(points, epsilon_) : points, epsilon_);
+  coefficients_ = SplineCoefficientsFromDataMatrix(data_);
+  arc_length_index_.build(data_.row(kArcLength));
+  return true;
+}
+
+bool CubicSpline::constructSplineData(const CartesianPointsView2D& points) {
+  if (points.cols() < 2) {
+    return false;
+  }
+  // Natural spline, fitted straight from the external buffer
   data_ = NaturalSplineDataMatrixFromPoints(points, epsilon_);
+  coefficients_ = SplineCoefficientsFromDataMatrix(data_);
+  arc_length_index_.build(data_.row(kArcLength));
   return true;
 }
 
 bool CubicSpline::constructSplineData(const CartesianPoints2D& points,
                                       const CartesianVector2D& first_tangent,
-                                      const CartesianVector2D& last_tangent) {
+                                      const CartesianVector2D& last_tangent,
+                                      const bool decimate_points) {
   if (points.size() < 2) {
     return false;
   }
   // clamped spline
-  data_ = ClampedSplineDataMatrixFromPoints(points, first_tangent, last_tangent,
-                                            epsilon_);
+  data_ = ClampedSplineDataMatrixFromPoints(
+      decimate_points ? DecimatePoints(points, epsilon_) : points,
+      first_tangent, last_tangent, epsilon_);
+  coefficients_ = SplineCoefficientsFromDataMatrix(data_);
+  arc_length_index_.build(data_.row(kArcLength));
   return true;
 }
 
+bool CubicSpline::constructSplineData(const DataMatrix<RealType>& data) {
+  if (data.rows() != BasicDataTypes::kSize || data.cols() < 2) {
+    return false;
+  }
+  data_ = data;
+  coefficients_ = SplineCoefficientsFromDataMatrix(data_);
+  arc_length_index_.build(data_.row(kArcLength));
+  return true;
+}
+
+bool CubicSpline::append(const CartesianPoints2D& points) {
+  if (points.empty()) {
+    return data_.cols() >= 2;
+  }
+  if (data_.cols() < 2) {
+    // Nothing to extend yet, construct the spline from scratch
+    return constructSplineData(points);
+  }
+  return constructSplineData(
+      AppendToSplineDataMatrix(data_, points, epsilon_));
+}
+
+bool CubicSpline::popFront(const DataSize n) {
+  if (n <= 0) {
+    return data_.cols() >= 2;
+  }
+  if (data_.cols() - n < 2) {
+    // Dropping n nodes would not leave a valid spline
+    return false;
+  }
+  DataMatrix<RealType> data = data_.rightCols(data_.cols() - n);
+  // Shift arc-lengths in place; points, moments and tangents are unaffected,
+  // the remaining segments keep their exact shape
+  data.row(kArcLength).array() -= data(kArcLength, 0);
+  return constructSplineData(data);
+}
+
 CartesianPoint2D CubicSpline::GetPositionAt(const RealType arc_length) const {
-  // Get segment index
+  // Get segment index and precomputed segment coefficients
   DataMatrix<RealType>::Index index = GetSegmentIndexAtArcLength(arc_length);
 
-  // Construct segment data
-  const DataSegment<RealType>& data_segment =
-      data_.block<kSize, 2>(kPoint_x, index);
-  const RealType relative_arc_length = arc_length - data_segment(kArcLength, 0);
-  return EvaluatePosition(data_segment, relative_arc_length);
+  const RealType relative_arc_length = arc_length - data_(kArcLength, index);
+  return coefficients_[index].interpolatePosition(relative_arc_length);
 }
 
-CartesianPoint2D CubicSpline::GetNormalVectorAt(
+CartesianVector2D CubicSpline::GetNormalVectorAt(
     const RealType arc_length) const {
-  // Get segment index
+  // Get segment index and precomputed segment coefficients
   DataMatrix<RealType>::Index index = GetSegmentIndexAtArcLength(arc_length);
 
-  // Construct segment data
-  const DataSegment<RealType>& data_segment =
-      data_.block<kSize, 2>(kPoint_x, index);
-  const RealType relative_arc_length = arc_length - data_segment(kArcLength, 0);
-  return EvaluateNormal(data_segment, relative_arc_length);
+  const RealType relative_arc_length = arc_length - data_(kArcLength, index);
+  return coefficients_[index].interpolateNormal(relative_arc_length);
 }
 
 RealType CubicSpline::GetCurvatureAt(const RealType arc_length) const {
-  // Get segment index
+  // Get segment index and precomputed segment coefficients
   DataMatrix<RealType>::Index index = GetSegmentIndexAtArcLength(arc_length);
 
-  // Construct segment data
-  const DataSegment<RealType>& data_segment =
-      data_.block<kSize, 2>(kPoint_x, index);
-
-  const RealType relative_arc_length = arc_length - data_segment(kArcLength, 0);
-
-  return InterpolateSignedCurvatureValue(data_segment, relative_arc_length);
+  const RealType relative_arc_length = arc_length - data_(kArcLength, index);
+  return coefficients_[index].interpolateSignedCurvatureValue(
+      relative_arc_length);
 }
 
 FrenetFrames2D CubicSpline::FrenetFrames(const CartesianPoint2D& point) const {
@@ -87,8 +138,18 @@ FrenetFrames2D CubicSpline::FrenetFrames(const CartesianPoint2D& point) const {
 
 FrenetPositionWithFrame CubicSpline::getFrenetPositionWithFrame(
     const CartesianPoint2D& point, const RealType arc_length_hint) const {
+  CORRIDOR_INSTRUMENT_SCOPED_TIMER(kProjectionDurationNs);
+  // Allocation-free single-result query; only degenerate, circle-like
+  // splines with more candidates than the stack buffer fall through to the
+  // allocating path below
+  FrenetPositionWithFrame result;
+  if (ConstructFrenetPositionWithFrame(data_, coefficients_, point, &result,
+                                       id_, arc_length_hint)) {
+    return result;
+  }
+
   FrenetPositionsWithFrames frenet_data =
-      ConstructFrenetPositionsWithFrames(data_, point, id_);
+      ConstructFrenetPositionsWithFrames(data_, coefficients_, point, id_);
 
   FrenetPositionsWithFrames::iterator p_iter;
   if (std::isnan(arc_length_hint)) {
@@ -113,7 +174,85 @@ FrenetPositionWithFrame CubicSpline::getFrenetPositionWithFrame(
 
 FrenetPolyline CubicSpline::toFrenetPolyline(
     const CartesianPoints2D& points) const {
-  return ConvertToFrenetPolyline(data_, points);
+  // Pack the points into a matrix and use the batched projection kernel
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> point_matrix;
+  point_matrix.resize(2, static_cast<Eigen::Index>(points.size()));
+  for (std::size_t i = 0; i < points.size(); i++) {
+    point_matrix.col(static_cast<Eigen::Index>(i)) = points[i];
+  }
+  return ConvertToFrenetPolyline(data_, coefficients_, point_matrix);
+}
+
+FrenetPolyline CubicSpline::projectPoints(
+    const Eigen::Ref<const Eigen::Matrix<RealType, 2, Eigen::Dynamic>>& points)
+    const {
+  return ConvertToFrenetPolyline(data_, coefficients_, points);
+}
+
+DataSize CubicSpline::toCartesianPolyline(
+    const FrenetPoints2D& frenet_points,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* cartesian_points) const {
+  assert(cartesian_points != nullptr);
+  const auto num_points = static_cast<DataSize>(frenet_points.size());
+  if (cartesian_points->cols() != num_points) {
+    cartesian_points->resize(2, num_points);
+  }
+  if (coefficients_.empty() || num_points == 0) {
+    return 0;
+  }
+
+  // Bucket the queries by segment: sorting by arc-length makes the queries
+  // of each segment one contiguous run in the order
+  std::vector<DataSize> order(frenet_points.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::sort(order.begin(), order.end(),
+            [&frenet_points](const DataSize a, const DataSize b) {
+              return frenet_points[a].l() < frenet_points[b].l();
+            });
+
+  using ArrayRow = Eigen::Array<RealType, 1, Eigen::Dynamic>;
+  ArrayRow local_l(num_points), deviations(num_points);
+  for (DataSize run_start = 0; run_start < num_points;) {
+    const auto segment_idx =
+        GetSegmentIndexAtArcLength(frenet_points[order[run_start]].l());
+    const RealType segment_start = data_(kArcLength, segment_idx);
+
+    // Collect all queries which fall into this segment
+    DataSize count = 0;
+    while (run_start + count < num_points &&
+           GetSegmentIndexAtArcLength(
+               frenet_points[order[run_start + count]].l()) == segment_idx) {
+      const FrenetPoint2D& query = frenet_points[order[run_start + count]];
+      local_l(count) = query.l() - segment_start;
+      deviations(count) = query.d();
+      count++;
+    }
+
+    // Evaluate position and normal of the whole run with one expression per
+    // row, then scatter back into the input order
+    const Coefficients2d& coeffs = coefficients_[segment_idx];
+    const auto l = local_l.head(count);
+    const auto ll = (l * l).eval();
+    const ArrayRow pos_x = coeffs.a_x + coeffs.b_x * l + coeffs.c_x * ll +
+                           coeffs.d_x * (ll * l);
+    const ArrayRow pos_y = coeffs.a_y + coeffs.b_y * l + coeffs.c_y * ll +
+                           coeffs.d_y * (ll * l);
+    const ArrayRow tangent_x = coeffs.b_x + 2 * coeffs.c_x * l +
+                               3 * coeffs.d_x * ll;
+    const ArrayRow tangent_y = coeffs.b_y + 2 * coeffs.c_y * l +
+                               3 * coeffs.d_y * ll;
+    const ArrayRow scaled_deviation =
+        deviations.head(count) *
+        (tangent_x.square() + tangent_y.square()).sqrt().inverse();
+    const ArrayRow cartesian_x = pos_x - tangent_y * scaled_deviation;
+    const ArrayRow cartesian_y = pos_y + tangent_x * scaled_deviation;
+    for (DataSize i = 0; i < count; i++) {
+      (*cartesian_points)(0, order[run_start + i]) = cartesian_x(i);
+      (*cartesian_points)(1, order[run_start + i]) = cartesian_y(i);
+    }
+    run_start += count;
+  }
+  return num_points;
 }
 
 void CubicSpline::fillCartesianPolyline(CartesianPoints2D* polyline,
@@ -137,21 +276,105 @@ void CubicSpline::fillCartesianPolyline(CartesianPoints2D* polyline,
   }
 }
 
+namespace {
+
+using SampleBuffer = Eigen::Matrix<RealType, 2, Eigen::Dynamic>;
+using ArrayRow = Eigen::Array<RealType, 1, Eigen::Dynamic>;
+
+void EvaluateSegmentSamples(const Coefficients2d& coeffs,
+                            const RealType segment_start_arc_length,
+                            const DataSize first_sample, const DataSize count,
+                            const RealType delta_l, SampleBuffer* positions,
+                            SampleBuffer* normals) {
+  // Local arc-lengths of all grid queries inside this segment
+  const ArrayRow local_l = ArrayRow::LinSpaced(
+      count,
+      static_cast<RealType>(first_sample) * delta_l - segment_start_arc_length,
+      static_cast<RealType>(first_sample + count - 1) * delta_l -
+          segment_start_arc_length);
+  const ArrayRow local_ll = local_l * local_l;
+  const ArrayRow local_lll = local_ll * local_l;
+
+  positions->row(0).segment(first_sample, count) =
+      (coeffs.a_x + coeffs.b_x * local_l + coeffs.c_x * local_ll +
+       coeffs.d_x * local_lll)
+          .matrix();
+  positions->row(1).segment(first_sample, count) =
+      (coeffs.a_y + coeffs.b_y * local_l + coeffs.c_y * local_ll +
+       coeffs.d_y * local_lll)
+          .matrix();
+
+  if (normals != nullptr) {
+    const ArrayRow tangent_x =
+        coeffs.b_x + 2 * coeffs.c_x * local_l + 3 * coeffs.d_x * local_ll;
+    const ArrayRow tangent_y =
+        coeffs.b_y + 2 * coeffs.c_y * local_l + 3 * coeffs.d_y * local_ll;
+    const ArrayRow inv_norm =
+        (tangent_x.square() + tangent_y.square()).sqrt().inverse();
+    normals->row(0).segment(first_sample, count) =
+        (-tangent_y * inv_norm).matrix();
+    normals->row(1).segment(first_sample, count) =
+        (tangent_x * inv_norm).matrix();
+  }
+}
+
+}  // namespace
+
+DataSize CubicSpline::sampleCartesianPolyline(const RealType delta_l,
+                                              SampleBuffer* positions,
+                                              SampleBuffer* normals) const {
+  assert(positions != nullptr);
+  if (coefficients_.empty() || delta_l <= 0.0) {
+    positions->resize(2, 0);
+    if (normals != nullptr) {
+      normals->resize(2, 0);
+    }
+    return 0;
+  }
+
+  const RealType total_length = GetTotalLength();
+  // Equidistant grid plus one sample exactly at the end of the spline
+  const DataSize num_grid_samples =
+      static_cast<DataSize>(std::floor(total_length / delta_l)) + 1;
+  const DataSize num_samples = num_grid_samples + 1;
+  positions->resize(2, num_samples);
+  if (normals != nullptr) {
+    normals->resize(2, num_samples);
+  }
+
+  DataSize sample_idx = 0;
+  const auto num_segments = static_cast<DataIdx>(coefficients_.size());
+  for (DataIdx idx = 0; idx < num_segments && sample_idx < num_grid_samples;
+       idx++) {
+    // The last segment takes all remaining grid samples
+    const RealType segment_end = (idx + 1 < num_segments)
+                                     ? data_(kArcLength, idx + 1)
+                                     : total_length + delta_l;
+    DataSize count = 0;
+    while (sample_idx + count < num_grid_samples &&
+           static_cast<RealType>(sample_idx + count) * delta_l < segment_end) {
+      count++;
+    }
+    if (count == 0) {
+      continue;
+    }
+    EvaluateSegmentSamples(coefficients_[idx], data_(kArcLength, idx),
+                           sample_idx, count, delta_l, positions, normals);
+    sample_idx += count;
+  }
+
+  // Last sample exactly at the end of the spline
+  positions->col(num_samples - 1) = GetPositionAt(total_length);
+  if (normals != nullptr) {
+    normals->col(num_samples - 1) = GetNormalVectorAt(total_length);
+  }
+  return num_samples;
+}
+
 const DataMatrix<RealType>::Index CubicSpline::GetSegmentIndexAtArcLength(
     const RealType arc_length) const noexcept {
-  DataMatrix<RealType>::Index index = 0;
-  DataMatrix<RealType>::Index max_index = data_.cols() - 2;
-  // Get index which is larger than the query arc_length
-  const bool valid =
-      (data_.row(kArcLength).array() > arc_length).maxCoeff(&index);
-  if (!valid) {
-    // Arc-length is longer as the refernce line. Return last segment
-    return max_index;
-  }
-  // Check that always a valid data segment is used
-  index = (0 < index) ? (index - 1) : (index);
-  index = (max_index < index) ? (max_index) : (index);
-  return index;
+  // O(1) lookup in the precomputed arc-length index
+  return arc_length_index_.segmentIndexAt(arc_length);
 }
 
 std::string CubicSpline::ToString(const bool print_header) const {
@@ -1,12 +1,43 @@
 #include "corridor/cubic_spline/cubic_spline_utilities.h"
 
-#include <chrono>
+#include <array>
+#include <atomic>
+#include <limits>
 
 #include "corridor/cubic_spline/cubic_spline_segment_root_finding.h"
+#include "corridor/internal/arena.h"
+#include "corridor/internal/instrumentation.h"
 
 namespace corridor {
 namespace cubic_spline {
 
+namespace {
+
+std::atomic<ProjectionErrorCallback> g_projection_error_callback{nullptr};
+std::atomic<std::uint64_t> g_projection_error_count{0};
+
+//! Branch-cheap failure reporting: one relaxed counter increment plus an
+//! indirect call only when a callback is installed; never touches iostreams
+inline void ReportProjectionError(const ProjectionError error,
+                                  const DataIdx segment_idx) {
+  g_projection_error_count.fetch_add(1, std::memory_order_relaxed);
+  const ProjectionErrorCallback callback =
+      g_projection_error_callback.load(std::memory_order_acquire);
+  if (callback != nullptr) {
+    callback(error, segment_idx);
+  }
+}
+
+}  // namespace
+
+void SetProjectionErrorCallback(const ProjectionErrorCallback callback) {
+  g_projection_error_callback.store(callback, std::memory_order_release);
+}
+
+std::uint64_t ProjectionErrorCount() {
+  return g_projection_error_count.load(std::memory_order_relaxed);
+}
+
 CartesianPoint2D EvaluatePosition(const DataSegment<RealType>& data_segment,
                                   const RealType arc_length) {
   const Coefficients2d segment_coeffs(data_segment.col(0), data_segment.col(1));
@@ -38,9 +69,7 @@ RealType InterpolateSignedCurvatureValue(
 }
 
 FrenetFrameTripod InterpolateFrenetFrameTripod(
-    const DataSegment<RealType>& data_segment, const RealType arc_length) {
-  const Coefficients2d segment_coeffs(data_segment.col(0), data_segment.col(1));
-
+    const Coefficients2d& segment_coeffs, const RealType arc_length) {
   const CartesianPoint2D origin =
       segment_coeffs.interpolatePosition(arc_length);
   // Tangent and Normal are normalized for safety reasons
@@ -62,6 +91,12 @@ FrenetFrameTripod InterpolateFrenetFrameTripod(
   return std::make_tuple(origin, tangent, normal, curvature_value, ccr_value);
 }
 
+FrenetFrameTripod InterpolateFrenetFrameTripod(
+    const DataSegment<RealType>& data_segment, const RealType arc_length) {
+  const Coefficients2d segment_coeffs(data_segment.col(0), data_segment.col(1));
+  return InterpolateFrenetFrameTripod(segment_coeffs, arc_length);
+}
+
 Eigen::Matrix<RealType, 2, Eigen::Dynamic> TangentsOnNodes(
     const DataMatrix<RealType>& data) {
   // 1) Construct all tangents
@@ -83,6 +118,64 @@ Eigen::Matrix<RealType, 2, Eigen::Dynamic> TangentsOnNodes(
   return tangents;
 }
 
+CartesianPoints2D DecimatePoints(const CartesianPoints2D& points,
+                                 const RealType epsilon) {
+  if (points.size() < 3 || epsilon <= 0.0) {
+    return points;
+  }
+
+  std::vector<bool> keep_point(points.size(), false);
+  keep_point.front() = true;
+  keep_point.back() = true;
+
+  // Iterative Douglas-Peucker: split each range at the point with the
+  // largest perpendicular distance to the chord until all points of the
+  // range lie within epsilon
+  std::vector<std::pair<std::size_t, std::size_t>> ranges;
+  ranges.emplace_back(0, points.size() - 1);
+  while (!ranges.empty()) {
+    const auto range = ranges.back();
+    ranges.pop_back();
+    if (range.second - range.first < 2) {
+      continue;
+    }
+
+    const CartesianVector2D chord = points[range.second] - points[range.first];
+    const RealType chord_length = chord.norm();
+
+    RealType max_distance = 0.0;
+    std::size_t max_idx = range.first;
+    for (std::size_t i = range.first + 1; i < range.second; i++) {
+      const CartesianVector2D delta = points[i] - points[range.first];
+      // Perpendicular distance to the chord; for degenerate chords
+      // (loop-like ranges) the point distance itself is used
+      const RealType distance =
+          (chord_length <= epsilon)
+              ? delta.norm()
+              : std::abs(chord.x() * delta.y() - chord.y() * delta.x()) /
+                    chord_length;
+      if (max_distance < distance) {
+        max_distance = distance;
+        max_idx = i;
+      }
+    }
+
+    if (epsilon < max_distance) {
+      keep_point[max_idx] = true;
+      ranges.emplace_back(range.first, max_idx);
+      ranges.emplace_back(max_idx, range.second);
+    }
+  }
+
+  CartesianPoints2D decimated_points;
+  for (std::size_t i = 0; i < points.size(); i++) {
+    if (keep_point[i]) {
+      decimated_points.emplace_back(points[i]);
+    }
+  }
+  return decimated_points;
+}
+
 RealType TangentialProjection(const CartesianPoint2D& point,
                               const Coefficients2d& segment_coeffs,
                               const RealType arc_length) {
@@ -122,8 +215,8 @@ RealType TangentialProjectionNewtonRaphson(const CartesianPoint2D& point,
 bool FindSegmentCandidates(
     const DataMatrix<RealType>& data, const CartesianPoint2D& point,
     SegmentInfoVector<DataIdx, RealType>* segment_points) {
-  // 1) all tangents on spline nodes
-  Eigen::Matrix<RealType, 2, Eigen::Dynamic> tangents = TangentsOnNodes(data);
+  // 1) all tangents on spline nodes, precomputed at construction
+  const auto& tangents = data.middleRows<2>(kTangent_x);
 
   // 2) relative vectors from spline nodes to point
   const auto relative_vectors = -(data.topRows(2).colwise() - point);
@@ -156,17 +249,78 @@ bool FindSegmentCandidates(
       segment_points->emplace_back(
           SegmentInfo<DataIdx, RealType>(last_segment_idx, delta_s));
     }
+    CORRIDOR_INSTRUMENT_RECORD(kSegmentCandidateCount,
+                               segment_points->size());
     return false;
   }
+  CORRIDOR_INSTRUMENT_RECORD(kSegmentCandidateCount, segment_points->size());
   return true;
 }
 
-bool FindProjectionOnSegment(const DataSegment<RealType>& data_segment,
+bool FindProjectionFromWarmStart(const DataMatrix<RealType>& data,
+                                 const SplineCoefficients2d& coefficients,
+                                 const CartesianPoint2D& point,
+                                 SegmentInfo<DataIdx, RealType>* segment_info,
+                                 const RealType epsilon) {
+  const auto num_segments = static_cast<DataIdx>(coefficients.size());
+  if (num_segments == 0 || segment_info->idx < 0 ||
+      num_segments <= segment_info->idx) {
+    return false;
+  }
+
+  // Consecutive projections of a tracked object move by fractions of a
+  // segment; if the warm start is further off than this many segment hops,
+  // the global search is cheaper and more robust.
+  constexpr int max_segment_hops = 3;
+
+  DataIdx idx = segment_info->idx;
+  RealType start_arc_length = segment_info->relative_arc_length;
+  for (int hop = 0; hop <= max_segment_hops; hop++) {
+    const Coefficients2d& segment_coeffs = coefficients[idx];
+
+    // Cheap bound checks: the sign of the tangential projection at the
+    // segment nodes tells on which side of the segment the projection lies.
+    if (segment_coeffs.tangentialProjection(0.0, point) < 0.0) {
+      if (idx == 0) {
+        // Point before first node, clamp to the spline start
+        *segment_info = SegmentInfo<DataIdx, RealType>(0, 0.0);
+        return true;
+      }
+      idx--;
+      start_arc_length = coefficients[idx].max_length;
+      continue;
+    }
+    if (0.0 < segment_coeffs.tangentialProjection(segment_coeffs.max_length,
+                                                  point)) {
+      if (idx == num_segments - 1) {
+        // Point behind last node, clamp to the spline end
+        *segment_info =
+            SegmentInfo<DataIdx, RealType>(idx, segment_coeffs.max_length);
+        return true;
+      }
+      idx++;
+      start_arc_length = 0.0;
+      continue;
+    }
+
+    // Root is bracketed in this segment, refine it locally
+    const auto root =
+        NewtonRaphsonMethod(segment_coeffs, start_arc_length, point, epsilon);
+    if (!root.first) {
+      return false;
+    }
+    *segment_info = SegmentInfo<DataIdx, RealType>(idx, root.second);
+    return true;
+  }
+  // Warm start diverged
+  return false;
+}
+
+bool FindProjectionOnSegment(const Coefficients2d& segment_coeffs,
                              SegmentInfo<DataIdx, RealType>* segment_info,
                              const CartesianPoint2D& point,
-                             const RealType epsilon) {
-  const Coefficients2d segment_coeffs(data_segment.col(0), data_segment.col(1));
-
+                             const RealType epsilon,
+                             const ProjectionMethod method) {
   // Limit initial arc-length to segment boundaries
   bool arc_length_limited, inside_segment_boundaries;
   RealType limited_arc_length;
@@ -174,28 +328,52 @@ bool FindProjectionOnSegment(const DataSegment<RealType>& data_segment,
       LimitArcLengthToSegmentLimits(
           segment_coeffs, segment_info->relative_arc_length, point, epsilon);
   if (arc_length_limited) {
+    CORRIDOR_INSTRUMENT_RECORD(kProjectionOutcomeClamped, 1);
     segment_info->relative_arc_length = limited_arc_length;
     return inside_segment_boundaries;
   }
 
+  if (method == ProjectionMethod::kPolynomial) {
+    const auto root = PolynomialRootsMethod(
+        segment_coeffs, segment_info->relative_arc_length, point, epsilon);
+    if (root.first) {
+      CORRIDOR_INSTRUMENT_RECORD(kProjectionOutcomePolynomial, 1);
+      segment_info->relative_arc_length = root.second;
+      return true;
+    }
+    // No real root found within the segment limits, fall back to Brent
+  }
+
   const auto root = BrentsMethod(
       segment_coeffs, segment_info->relative_arc_length, point, epsilon);
+  CORRIDOR_INSTRUMENT_RECORD(kProjectionOutcomeBrent, 1);
   segment_info->relative_arc_length = root.second;
 
   return root.first;
 }
 
-FrenetFrame2D ConstructFrenetFrame(const DataSegment<RealType>& data_segment,
+bool FindProjectionOnSegment(const DataSegment<RealType>& data_segment,
+                             SegmentInfo<DataIdx, RealType>* segment_info,
+                             const CartesianPoint2D& point,
+                             const RealType epsilon,
+                             const ProjectionMethod method) {
+  const Coefficients2d segment_coeffs(data_segment.col(0), data_segment.col(1));
+  return FindProjectionOnSegment(segment_coeffs, segment_info, point, epsilon,
+                                 method);
+}
+
+FrenetFrame2D ConstructFrenetFrame(const Coefficients2d& segment_coeffs,
+                                   const RealType segment_start_arc_length,
                                    SegmentInfo<DataIdx, RealType> segment_info,
                                    const IdType id) {
   const RealType arc_length =
-      data_segment.col(0)[kArcLength] + segment_info.relative_arc_length;
+      segment_start_arc_length + segment_info.relative_arc_length;
   // Fill Frenet Frame structure
   const SegmentInfo<IdxType, RealType> seg_point(
       static_cast<IdxType>(segment_info.idx), segment_info.relative_arc_length);
 
   const FrenetFrameTripod tuple = InterpolateFrenetFrameTripod(
-      data_segment, segment_info.relative_arc_length);
+      segment_coeffs, segment_info.relative_arc_length);
 
   const CartesianPoint2D& origin = std::get<0>(tuple);
   const CartesianPoint2D& tangent = std::get<1>(tuple);
@@ -212,6 +390,14 @@ FrenetFrame2D ConstructFrenetFrame(const DataSegment<RealType>& data_segment,
   return frenet_frame;
 }
 
+FrenetFrame2D ConstructFrenetFrame(const DataSegment<RealType>& data_segment,
+                                   SegmentInfo<DataIdx, RealType> segment_info,
+                                   const IdType id) {
+  const Coefficients2d segment_coeffs(data_segment.col(0), data_segment.col(1));
+  return ConstructFrenetFrame(segment_coeffs, data_segment.col(0)[kArcLength],
+                              segment_info, id);
+}
+
 FrenetFrames2D ConstructFrenetFrames(const DataMatrix<RealType>& data,
                                      const CartesianPoint2D& point) {
   FrenetPositionsWithFrames positions_with_frames =
@@ -243,9 +429,8 @@ FrenetPositionsWithFrames ConstructFrenetPositionsWithFrames(
       const bool success =
           FindProjectionOnSegment(data_segment, &segment, point);
       if (!success) {
-        std::cout << "ERROR: no valid Frenet Frame found on segment candidate: "
-                  << segment.idx << std::endl;
-        assert(false);
+        ReportProjectionError(ProjectionError::kNoRootOnSegmentCandidate,
+                              segment.idx);
       }
     }
     positions_with_frames.emplace_back(
@@ -254,6 +439,137 @@ FrenetPositionsWithFrames ConstructFrenetPositionsWithFrames(
   return positions_with_frames;
 }
 
+FrenetPositionsWithFrames ConstructFrenetPositionsWithFrames(
+    const DataMatrix<RealType>& data, const SplineCoefficients2d& coefficients,
+    const CartesianPoint2D& point, const IdType id) {
+  // Get all relevant spline segments (perpendicular projection)
+  SegmentInfoVector<DataIdx, RealType> segment_candidates;
+  bool matched = FindSegmentCandidates(data, point, &segment_candidates);
+
+  // Find pependicular projection of point onto segments, reusing the segment
+  // coefficients precomputed at spline construction
+  FrenetPositionsWithFrames positions_with_frames;
+  for (auto& segment : segment_candidates) {
+    const Coefficients2d& segment_coeffs = coefficients[segment.idx];
+    if (matched) {
+      // Only try to find the projection point if the point was matched to the
+      // segments. In case it wasn't matched, the point is located before or
+      // after the spline (or both, in case of a circle like spline). Then,
+      // the arc-length is already correct.
+      const bool success =
+          FindProjectionOnSegment(segment_coeffs, &segment, point);
+      if (!success) {
+        ReportProjectionError(ProjectionError::kNoRootOnSegmentCandidate,
+                              segment.idx);
+      }
+    }
+    positions_with_frames.emplace_back(
+        ConstructFrenetFrame(segment_coeffs, data.col(segment.idx)[kArcLength],
+                             segment, id),
+        point);
+  }
+  return positions_with_frames;
+}
+
+bool ConstructFrenetPositionWithFrame(
+    const DataMatrix<RealType>& data, const SplineCoefficients2d& coefficients,
+    const CartesianPoint2D& point,
+    FrenetPositionWithFrame* position_with_frame, const IdType id,
+    const RealType arc_length_hint) {
+  const DataIdx num_nodes = data.cols();
+  if (num_nodes < 2) {
+    return false;
+  }
+
+  // Candidate search as in FindSegmentCandidates, but with scalar per-node
+  // projections into a fixed-capacity buffer instead of a heap allocated
+  // vector
+  std::array<SegmentInfo<DataIdx, RealType>, kMaxSegmentCandidates> candidates;
+  std::size_t num_candidates = 0;
+
+  const auto node_projection = [&data, &point](const DataIdx idx) {
+    return data.block<2, 1>(kTangent_x, idx)
+        .dot(point - data.block<2, 1>(kPoint_x, idx));
+  };
+
+  RealType projection = node_projection(0);
+  const RealType first_projection = projection;
+  for (DataIdx idx = 0, n = num_nodes - 1; idx < n; idx++) {
+    const RealType next_projection = node_projection(idx + 1);
+    if (0.0 <= projection && next_projection < 0.f) {
+      if (num_candidates == kMaxSegmentCandidates) {
+        // Degenerate, circle-like spline: fall back to the allocating path
+        return false;
+      }
+      candidates[num_candidates++] =
+          SegmentInfo<DataIdx, RealType>(idx, projection);
+    }
+    projection = next_projection;
+  }
+
+  bool matched = true;
+  if (num_candidates == 0) {
+    // Point is located before the first node and/or behind the last node (or
+    // both, in case of a circle like spline); the arc-length is clamped to
+    // the spline limits
+    matched = false;
+    if (first_projection <= 0.f) {
+      candidates[num_candidates++] = SegmentInfo<DataIdx, RealType>(0, 0.0);
+    }
+    if (0.0 <= projection) {
+      const auto delta_s = (data.col(num_nodes - 1)[kArcLength] -
+                            data.col(num_nodes - 2)[kArcLength]);
+      candidates[num_candidates++] =
+          SegmentInfo<DataIdx, RealType>(num_nodes - 2, delta_s);
+    }
+  }
+
+  CORRIDOR_INSTRUMENT_RECORD(kSegmentCandidateCount, num_candidates);
+
+  // Resolve the candidate projections and keep the best match; the frenet
+  // frame is only constructed once for the selected candidate
+  std::size_t best_candidate = 0;
+  RealType best_selection_value = std::numeric_limits<RealType>::max();
+  for (std::size_t i = 0; i < num_candidates; i++) {
+    SegmentInfo<DataIdx, RealType>& segment = candidates[i];
+    const Coefficients2d& segment_coeffs = coefficients[segment.idx];
+    if (matched) {
+      const bool success =
+          FindProjectionOnSegment(segment_coeffs, &segment, point);
+      if (!success) {
+        ReportProjectionError(ProjectionError::kNoRootOnSegmentCandidate,
+                              segment.idx);
+      }
+    }
+
+    RealType selection_value;
+    if (std::isnan(arc_length_hint)) {
+      // Smallest absolute deviation from the reference line
+      const CartesianPoint2D origin =
+          segment_coeffs.interpolatePosition(segment.relative_arc_length);
+      const CartesianPoint2D normal =
+          segment_coeffs.interpolateNormal(segment.relative_arc_length)
+              .normalized();
+      selection_value = std::abs(normal.dot(point - origin));
+    } else {
+      // Closest arc-length to the hint
+      selection_value = std::abs(data.col(segment.idx)[kArcLength] +
+                                 segment.relative_arc_length - arc_length_hint);
+    }
+    if (selection_value < best_selection_value) {
+      best_selection_value = selection_value;
+      best_candidate = i;
+    }
+  }
+
+  const SegmentInfo<DataIdx, RealType>& segment = candidates[best_candidate];
+  *position_with_frame = FrenetPositionWithFrame(
+      ConstructFrenetFrame(coefficients[segment.idx],
+                           data.col(segment.idx)[kArcLength], segment, id),
+      point);
+  return true;
+}
+
 FrenetPoint2D ConvertToFrenetPoint2D(const DataMatrix<RealType>& data,
                                      const CartesianPoint2D& point) {
   // Construct frenet frame candidates for conversion
@@ -278,5 +594,103 @@ FrenetPolyline ConvertToFrenetPolyline(const DataMatrix<RealType>& data,
   return polyline;
 }
 
+FrenetPolyline ConvertToFrenetPolyline(
+    const DataMatrix<RealType>& data, const SplineCoefficients2d& coefficients,
+    const Eigen::Ref<const Eigen::Matrix<RealType, 2, Eigen::Dynamic>>&
+        points) {
+  const auto num_points = points.cols();
+  const auto num_nodes = data.cols();
+  const auto num_segments = num_nodes - 1;
+  FrenetPolyline polyline(num_points);
+  if (num_points == 0 || num_segments < 1) {
+    return polyline;
+  }
+
+  // 1) Tangential projections of all points onto all node tangents as one
+  // matrix product: projections(node, point) = t_node . (point - node)
+  const auto& tangents = data.middleRows<2>(kTangent_x);
+  const Eigen::Matrix<RealType, Eigen::Dynamic, 1> node_offsets =
+      tangents.cwiseProduct(data.topRows(2)).colwise().sum().transpose();
+  Eigen::Matrix<RealType, Eigen::Dynamic, Eigen::Dynamic> projections =
+      tangents.transpose() * points;
+  projections.colwise() -= node_offsets;
+
+  // 2) Collect candidate segments per point (same rules as
+  // FindSegmentCandidates) and bucket them per segment, so each segment's
+  // coefficients are reused for all of its candidate points
+  struct PointOnSegment {
+    Eigen::Index point_idx;
+    RealType relative_arc_length;
+    bool matched;
+  };
+  // Query-scope temporaries: drawn from the thread's active QueryArena (if
+  // one is installed via ScopedQueryArena), heap otherwise
+  ArenaVector<ArenaVector<PointOnSegment>> segment_buckets(num_segments);
+  for (Eigen::Index p = 0; p < num_points; p++) {
+    bool matched = false;
+    for (DataIdx idx = 0; idx < num_segments; idx++) {
+      if (0.0 <= projections(idx, p) && projections(idx + 1, p) < 0.f) {
+        // Re-evaluate the projection of the few selected candidates as
+        // t . (point - node): the boundary checks of the root search are
+        // sensitive to the last ulps, which differ between the factored
+        // matrix product above and the per-point evaluation.
+        const RealType exact_projection =
+            tangents.col(idx).dot(points.col(p) -
+                                  data.block<2, 1>(kPoint_x, idx));
+        segment_buckets[idx].push_back({p, exact_projection, true});
+        matched = true;
+      }
+    }
+    if (!matched) {
+      if (projections(0, p) <= 0.f) {
+        // Point before first node
+        segment_buckets[0].push_back({p, 0.0, false});
+      }
+      if (0.0 <= projections(num_nodes - 1, p)) {
+        // Point behind last node
+        const auto delta_s = (data.col(num_nodes - 1)[kArcLength] -
+                              data.col(num_nodes - 2)[kArcLength]);
+        segment_buckets[num_segments - 1].push_back({p, delta_s, false});
+      }
+    }
+  }
+
+  // 3) Resolve the roots segment by segment and keep the projection with the
+  // smallest deviation from the reference line per point
+  ArenaVector<RealType> smallest_deviation(
+      num_points, std::numeric_limits<RealType>::max());
+  for (DataIdx idx = 0; idx < num_segments; idx++) {
+    if (segment_buckets[idx].empty()) {
+      continue;
+    }
+    const Coefficients2d& segment_coeffs = coefficients[idx];
+    const RealType segment_start_arc_length = data.col(idx)[kArcLength];
+    for (const auto& candidate : segment_buckets[idx]) {
+      SegmentInfo<DataIdx, RealType> segment(idx,
+                                             candidate.relative_arc_length);
+      const CartesianPoint2D point = points.col(candidate.point_idx);
+      if (candidate.matched) {
+        const bool success =
+            FindProjectionOnSegment(segment_coeffs, &segment, point);
+        if (!success) {
+          ReportProjectionError(ProjectionError::kNoRootOnSegmentCandidate,
+                                segment.idx);
+        }
+      }
+      const FrenetPositionWithFrame position_with_frame(
+          ConstructFrenetFrame(segment_coeffs, segment_start_arc_length,
+                               segment),
+          point);
+      if (position_with_frame.position.d_value() <
+          smallest_deviation[candidate.point_idx]) {
+        smallest_deviation[candidate.point_idx] =
+            position_with_frame.position.d_value();
+        polyline.SetPoint(candidate.point_idx, position_with_frame.position);
+      }
+    }
+  }
+  return polyline;
+}
+
 }  // namespace cubic_spline
 }  // namespace corridor
@@ -24,7 +24,7 @@ CartesianVector2D FrenetFrame2D::FromFrenetVector(
   const FrenetVector2D relative_vector{
       frenet_vector.l() - frenet_base_.arc_length, frenet_vector.d()};
   // Coordination transformation
-  return rotMat_F2C_ * relative_vector;
+  return rotMat_F2C() * relative_vector;
 };
 
 FrenetPoint2D FrenetFrame2D::FromCartesianPoint(
@@ -41,7 +41,7 @@ FrenetPoint2D FrenetFrame2D::FromCartesianPoint(
 FrenetVector2D FrenetFrame2D::FromCartesianVector(
     const CartesianVector2D& cartesian_vector) const {
   //! Coordination transformation
-  FrenetVector2D frenet_vector = rotMat_C2F_ * cartesian_vector;
+  FrenetVector2D frenet_vector = rotMat_C2F() * cartesian_vector;
   return frenet_vector;
 };
 
@@ -94,8 +94,9 @@ FrenetStateCovarianceMatrix2D FrenetFrame2D::FromCartesianStateCovarianceMatrix(
       Eigen::Matrix<corridor::RealType, 4, 4>::Zero();
 
   // Fill with 2d rotation matrices
-  rotation_matrix.block<2, 2>(0, 0) = rotMat_C2F_;
-  rotation_matrix.block<2, 2>(2, 2) = rotMat_C2F_;
+  const RotationMatrix rot_mat_c2f = rotMat_C2F();
+  rotation_matrix.block<2, 2>(0, 0) = rot_mat_c2f;
+  rotation_matrix.block<2, 2>(2, 2) = rot_mat_c2f;
 
   // Linear transformation of the covariance matrices.
   return rotation_matrix * state_vector_covariance_matrix *
@@ -129,7 +130,7 @@ FrenetFrame2D::JacobianMatrix FrenetFrame2D::defineJacobianMatrix(
   // Jacobean matrix at cartesian mean
   Eigen::Matrix<RealType, 4, 4> jacobian_matrix =
       Eigen::Matrix<RealType, 4, 4>::Zero();
-  jacobian_matrix.block<2, 2>(0, 0) = rotMat_C2F_;
+  jacobian_matrix.block<2, 2>(0, 0) = rotMat_C2F();
   jacobian_matrix(2, 0) = frenet_base_.curvature * vp * normal_.x();
   jacobian_matrix(2, 1) = frenet_base_.curvature * vp * normal_.y();
   jacobian_matrix(2, 2) = tangent_.x() + frenet_base_.curvature * tangent_.x() *
@@ -164,20 +165,10 @@ RealType FrenetPolyline::deviationAt(const RealType query_l) const {
   }
 
   //! Get index of segment which contains the arc-length
-  DataMatrix::Index index = 0;
-  DataMatrix::Index max_index =
-      data_.cols() - 2;  // first index of last segment
-  const bool valid = (data_.row(kArclength).array() > query_l).maxCoeff(&index);
-
-  if (valid) {
-    // Check that always a valid data segment is used
-    index = (0 < index) ? (index - 1) : (index);
-    index = (max_index < index) ? (max_index) : (index);
-  } else {
-    // Arc-length is longer as the refernce line. Use last segment start
-    // index
-    index = (valid) ? (index) : (max_index);
+  if (arc_length_index_.empty()) {
+    arc_length_index_.build(data_.row(kArclength));
   }
+  const DataMatrix::Index index = arc_length_index_.segmentIndexAt(query_l);
 
   if (index + 1 >= data_.cols()) {
     return data_(DataType::kDeviation, index);
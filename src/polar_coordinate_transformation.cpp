@@ -7,9 +7,67 @@
 namespace corridor {
 namespace unscented_transformation {
 
-Eigen::Vector2d CartesianToPolarTransformation2D(
-    const Eigen::Vector2d& cartesian_vector) {
-  Eigen::Vector2d polar_vector;
+namespace {
+
+// Nonlinearity criterion for the Cartesian -> polar conversion: first-order
+// Jacobian propagation is within tolerance as long as the radius is well
+// separated from zero and the velocity uncertainty is small relative to the
+// magnitude. Outside of that regime the full unscented transformation is
+// used.
+constexpr RealType kMinSquaredRadius = 1e-6;
+constexpr RealType kMaxRelativeVariance = 1e-2;
+
+bool LinearizationIsAccurate(
+    const Eigen::Matrix<RealType, 2, 1>& cartesian_vector,
+    const Eigen::Matrix<RealType, 2, 2>& cov_mat) {
+  const RealType squared_radius = cartesian_vector.squaredNorm();
+  if (squared_radius < kMinSquaredRadius) {
+    return false;
+  }
+  return cov_mat.trace() < kMaxRelativeVariance * squared_radius;
+}
+
+// First-order propagation through the polar transformation: mean through the
+// exact map, covariance through the analytic Jacobian J * P * J^T
+void LinearizedToPolarCoordinates2D(
+    const Eigen::Matrix<RealType, 2, 1>& initial_x,
+    const Eigen::Matrix<RealType, 2, 2>& initial_P, PolarVector2D* resulting_x,
+    PolarCovarianceMatrix2D* resulting_P) {
+  (*resulting_x) = CartesianToPolarTransformation2D(initial_x);
+  const RealType radius = (*resulting_x)(0);
+  const RealType inv_radius = 1.0 / radius;
+  const RealType inv_squared_radius = inv_radius * inv_radius;
+  Eigen::Matrix<RealType, 2, 2> jacobian;
+  jacobian << initial_x(0) * inv_radius, initial_x(1) * inv_radius,
+      -initial_x(1) * inv_squared_radius, initial_x(0) * inv_squared_radius;
+  (*resulting_P) = jacobian * initial_P * jacobian.transpose();
+}
+
+// Full unscented transformation with a caller-provided sigma point
+// generator, so batch conversions can share one generator
+void UnscentedToPolarCoordinates2D(
+    MerweScaledSigmaPoints<2>& sigma_pts_generator,
+    const Eigen::Matrix<RealType, 2, 1>& initial_x,
+    const Eigen::Matrix<RealType, 2, 2>& initial_P, PolarVector2D* resulting_x,
+    PolarCovarianceMatrix2D* resulting_P) {
+  const auto& sigmas =
+      sigma_pts_generator.generateSigmaPoints(initial_x, initial_P);
+
+  Eigen::Matrix<RealType, 2, 5, Eigen::DontAlign> transformed_sigmas;
+  for (int i = 0; i < sigmas.cols(); i++) {
+    transformed_sigmas.col(i) = CartesianToPolarTransformation2D(sigmas.col(i));
+  }
+
+  EstimateStateMeanAndCovarianceMatrix(
+      transformed_sigmas, sigma_pts_generator.weightsMean(),
+      sigma_pts_generator.weightsCovMat(), (*resulting_x), (*resulting_P), 1);
+}
+
+}  // namespace
+
+Eigen::Matrix<RealType, 2, 1> CartesianToPolarTransformation2D(
+    const Eigen::Matrix<RealType, 2, 1>& cartesian_vector) {
+  Eigen::Matrix<RealType, 2, 1> polar_vector;
   const auto& x1 = cartesian_vector(0);
   const auto& x2 = cartesian_vector(1);
   polar_vector(0) = std::sqrt(x1 * x1 + x2 * x2);
@@ -17,9 +75,9 @@ Eigen::Vector2d CartesianToPolarTransformation2D(
   return polar_vector;
 };
 
-Eigen::Vector2d PolarToCartesianTransformation2D(
-    const Eigen::Vector2d& polar_vector) {
-  Eigen::Vector2d cartesian_vector;
+Eigen::Matrix<RealType, 2, 1> PolarToCartesianTransformation2D(
+    const Eigen::Matrix<RealType, 2, 1>& polar_vector) {
+  Eigen::Matrix<RealType, 2, 1> cartesian_vector;
   const auto& radius = polar_vector(0);
   const auto& phi = polar_vector(1);
   cartesian_vector(0) = radius * std::cos(phi);
@@ -27,30 +85,25 @@ Eigen::Vector2d PolarToCartesianTransformation2D(
   return cartesian_vector;
 };
 
-void ToPolarCoordinates2D(const Eigen::Vector2d& initial_x,
-                          const Eigen::Matrix2d& initial_P,
+void ToPolarCoordinates2D(const Eigen::Matrix<RealType, 2, 1>& initial_x,
+                          const Eigen::Matrix<RealType, 2, 2>& initial_P,
                           PolarVector2D* resulting_x,
                           PolarCovarianceMatrix2D* resulting_P) {
   // State transformation: vel_x, vel_y -> abs_vel, theta
-  MerweScaledSigmaPoints<2> sigma_pts_generator;
-  const auto& sigmas =
-      sigma_pts_generator.generateSigmaPoints(initial_x, initial_P);
-
-  // Transformation function
-  Eigen::MatrixXd transformed_sigmas(initial_x.rows(), sigmas.cols());
-  for (int i = 0; i < sigmas.cols(); i++) {
-    transformed_sigmas.col(i) = CartesianToPolarTransformation2D(sigmas.col(i));
+  if (LinearizationIsAccurate(initial_x, initial_P)) {
+    LinearizedToPolarCoordinates2D(initial_x, initial_P, resulting_x,
+                                   resulting_P);
+    return;
   }
-
-  EstimateStateMeanAndCovarianceMatrix(
-      transformed_sigmas, sigma_pts_generator.weightsMean(),
-      sigma_pts_generator.weightsCovMat(), (*resulting_x), (*resulting_P), 1);
+  MerweScaledSigmaPoints<2> sigma_pts_generator;
+  UnscentedToPolarCoordinates2D(sigma_pts_generator, initial_x, initial_P,
+                                resulting_x, resulting_P);
 };
 
 void FromPolarCoordinates2D(const PolarVector2D& initial_x,
                             const PolarCovarianceMatrix2D& initial_P,
-                            Eigen::Vector2d* resulting_x,
-                            Eigen::Vector2d* resulting_P) {
+                            Eigen::Matrix<RealType, 2, 1>* resulting_x,
+                            Eigen::Matrix<RealType, 2, 1>* resulting_P) {
   // State tranformation: vel_x, vel_y -> abs_vel, theta
   MerweScaledSigmaPoints<2> sigma_pts_generator;
 
@@ -58,7 +111,8 @@ void FromPolarCoordinates2D(const PolarVector2D& initial_x,
       sigma_pts_generator.generateSigmaPoints(initial_x, initial_P);
 
   // Transformation function
-  Eigen::MatrixXd transformed_sigmas(initial_x.rows(), sigmas.cols());
+  Eigen::Matrix<RealType, Eigen::Dynamic, Eigen::Dynamic> transformed_sigmas(
+      initial_x.rows(), sigmas.cols());
   for (int i = 0; i < sigmas.cols(); i++) {
     transformed_sigmas.col(i) = PolarToCartesianTransformation2D(sigmas.col(i));
   }
@@ -68,5 +122,51 @@ void FromPolarCoordinates2D(const PolarVector2D& initial_x,
       sigma_pts_generator.weightsCovMat(), (*resulting_x), (*resulting_P), 1);
 };
 
+void ToPolarCoordinates2D(
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_means,
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_cov_mats,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_means,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_cov_mats) {
+  assert(resulting_means != nullptr && resulting_cov_mats != nullptr);
+  const auto num_states = initial_means.cols();
+  assert(initial_cov_mats.cols() == 2 * num_states);
+  if (resulting_means->cols() != num_states) {
+    resulting_means->resize(2, num_states);
+  }
+  if (resulting_cov_mats->cols() != 2 * num_states) {
+    resulting_cov_mats->resize(2, 2 * num_states);
+  }
+
+  // Same per-state dispatch as the scalar overload; only the sigma point
+  // generator for the fallback states is shared across the batch
+  MerweScaledSigmaPoints<2> sigma_pts_generator;
+  for (Eigen::Index i = 0; i < num_states; i++) {
+    const Eigen::Matrix<RealType, 2, 1> mean = initial_means.col(i);
+    const Eigen::Matrix<RealType, 2, 2> cov_mat =
+        initial_cov_mats.block<2, 2>(0, 2 * i);
+    PolarVector2D polar_mean;
+    PolarCovarianceMatrix2D polar_cov_mat;
+    if (LinearizationIsAccurate(mean, cov_mat)) {
+      LinearizedToPolarCoordinates2D(mean, cov_mat, &polar_mean,
+                                     &polar_cov_mat);
+    } else {
+      UnscentedToPolarCoordinates2D(sigma_pts_generator, mean, cov_mat,
+                                    &polar_mean, &polar_cov_mat);
+    }
+    resulting_means->col(i) = polar_mean;
+    resulting_cov_mats->block<2, 2>(0, 2 * i) = polar_cov_mat;
+  }
+};
+
+void FromPolarCoordinates2D(
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_means,
+    const Eigen::Matrix<RealType, 2, Eigen::Dynamic>& initial_cov_mats,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_means,
+    Eigen::Matrix<RealType, 2, Eigen::Dynamic>* resulting_cov_mats) {
+  BatchUnscentedTransformation<2>(initial_means, initial_cov_mats,
+                                  &PolarToCartesianTransformation2D,
+                                  resulting_means, resulting_cov_mats, 1);
+};
+
 }  // namespace unscented_transformation
 }  // namespace corridor
\ No newline at end of file
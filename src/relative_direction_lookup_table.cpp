@@ -0,0 +1,90 @@
+#include "corridor/corridor_assignment/relative_direction_lookup_table.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "corridor/corridor_assignment/corridor_assignment.h"
+
+namespace corridor {
+
+namespace {
+
+//! Fixed direction angles of the four semantic labels, in plane order
+constexpr std::array<RealType, 4> kDirectionAngles = {
+    {0.0 /*downstream*/, M_PI /*upstream*/, M_PI_2 /*towards left*/,
+     -M_PI_2 /*towards right*/}};
+
+constexpr std::array<SemanticLabel, 4> kPlaneLabels = {
+    {SemanticLabel::kDownstream, SemanticLabel::kUpstream,
+     SemanticLabel::kTowardsLeft, SemanticLabel::kTowardsRight}};
+
+}  // namespace
+
+RelativeDirectionLookupTable::RelativeDirectionLookupTable(
+    const RealType sigma_band, const std::size_t num_heading_samples,
+    const std::size_t num_sigma_samples, const RealType min_sigma,
+    const RealType max_sigma)
+    : sigma_band_(sigma_band), min_sigma_(min_sigma), max_sigma_(max_sigma) {
+  assert(num_heading_samples >= 2 && num_sigma_samples >= 2);
+  assert(min_sigma_ < max_sigma_);
+  const auto rows = static_cast<Eigen::Index>(num_heading_samples);
+  const auto cols = static_cast<Eigen::Index>(num_sigma_samples);
+  heading_step_ = 2.0 * M_PI / static_cast<RealType>(num_heading_samples - 1);
+  sigma_step_ =
+      (max_sigma_ - min_sigma_) / static_cast<RealType>(num_sigma_samples - 1);
+
+  // Sample the exact integrals once per grid node and label
+  for (std::size_t label_idx = 0; label_idx < planes_.size(); label_idx++) {
+    planes_[label_idx].resize(rows, cols);
+    for (Eigen::Index row = 0; row < rows; row++) {
+      const RealType heading =
+          -M_PI + static_cast<RealType>(row) * heading_step_;
+      for (Eigen::Index col = 0; col < cols; col++) {
+        const RealType sigma =
+            min_sigma_ + static_cast<RealType>(col) * sigma_step_;
+        planes_[label_idx](row, col) = RelativeOrientationConfidence(
+            kDirectionAngles[label_idx], {heading, sigma}, sigma_band_);
+      }
+    }
+  }
+}
+
+RealType RelativeDirectionLookupTable::interpolate(const std::size_t label_idx,
+                                                   const RealType heading,
+                                                   const RealType sigma) const {
+  const auto& plane = planes_[label_idx];
+
+  const RealType row_pos = (heading + M_PI) / heading_step_;
+  const RealType col_pos = (sigma - min_sigma_) / sigma_step_;
+
+  const auto row = std::min(static_cast<Eigen::Index>(row_pos),
+                            plane.rows() - 2);
+  const auto col = std::min(static_cast<Eigen::Index>(col_pos),
+                            plane.cols() - 2);
+  const RealType row_frac = row_pos - static_cast<RealType>(row);
+  const RealType col_frac = col_pos - static_cast<RealType>(col);
+
+  const RealType top = (1.0 - col_frac) * plane(row, col) +
+                       col_frac * plane(row, col + 1);
+  const RealType bottom = (1.0 - col_frac) * plane(row + 1, col) +
+                          col_frac * plane(row + 1, col + 1);
+  return (1.0 - row_frac) * top + row_frac * bottom;
+}
+
+SemanticLabelSet RelativeDirectionLookupTable::labelSet(
+    const UncertainValue& relative_heading_angle) const {
+  const RealType heading = constrainAngle(relative_heading_angle.value);
+  const RealType sigma =
+      std::min(std::max(relative_heading_angle.standard_deviation, min_sigma_),
+               max_sigma_);
+
+  SemanticLabelPairs pairs;
+  pairs.reserve(planes_.size());
+  for (std::size_t label_idx = 0; label_idx < planes_.size(); label_idx++) {
+    pairs.emplace_back(kPlaneLabels[label_idx],
+                       interpolate(label_idx, heading, sigma));
+  }
+  return SemanticLabelSet(pairs);
+}
+
+}  // namespace corridor
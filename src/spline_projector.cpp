@@ -0,0 +1,40 @@
+#include "corridor/cubic_spline/spline_projector.h"
+
+#include <cassert>
+
+#include "corridor/cubic_spline/cubic_spline_utilities.h"
+
+using namespace corridor;
+using namespace cubic_spline;
+
+FrenetPositionWithFrame SplineProjector::project(
+    const CartesianPoint2D& point) {
+  assert(spline_ != nullptr);
+
+  if (last_match_valid_) {
+    SegmentInfo<DataIdx, RealType> segment_info = last_match_;
+    const bool success = FindProjectionFromWarmStart(
+        spline_->data_, spline_->coefficients_, point, &segment_info);
+    if (success) {
+      last_match_ = segment_info;
+      const RealType segment_start_arc_length =
+          spline_->data_(kArcLength, segment_info.idx);
+      return FrenetPositionWithFrame(
+          ConstructFrenetFrame(spline_->coefficients_[segment_info.idx],
+                               segment_start_arc_length, segment_info,
+                               spline_->GetId()),
+          point);
+    }
+  }
+
+  // Cold path: global segment search. Its result seeds the next warm start.
+  const FrenetPositionWithFrame position_with_frame =
+      spline_->getFrenetPositionWithFrame(point);
+  const auto& matched_segment =
+      position_with_frame.frame.frenet_base().segment_info;
+  last_match_ = SegmentInfo<DataIdx, RealType>(
+      static_cast<DataIdx>(matched_segment.idx),
+      matched_segment.relative_arc_length);
+  last_match_valid_ = true;
+  return position_with_frame;
+}
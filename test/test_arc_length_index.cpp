@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <Eigen/Core>
+
+#include "corridor/internal/arc_length_index.h"
+
+using namespace corridor;
+
+using DataRow = Eigen::Matrix<RealType, 1, Eigen::Dynamic>;
+
+class ArcLengthIndexTest : public ::testing::Test {};
+
+TEST_F(ArcLengthIndexTest, UniformSampling) {
+  DataRow arc_lengths(6);
+  arc_lengths << 0.0, 1.0, 2.0, 3.0, 4.0, 5.0;
+
+  ArcLengthIndex index;
+  index.build(arc_lengths);
+  EXPECT_FALSE(index.empty());
+
+  EXPECT_EQ(index.segmentIndexAt(0.0), 0);
+  EXPECT_EQ(index.segmentIndexAt(0.5), 0);
+  EXPECT_EQ(index.segmentIndexAt(1.0), 1);
+  EXPECT_EQ(index.segmentIndexAt(2.5), 2);
+  EXPECT_EQ(index.segmentIndexAt(4.99), 4);
+
+  // Out-of-range queries are clamped to the first and last segment
+  EXPECT_EQ(index.segmentIndexAt(-1.0), 0);
+  EXPECT_EQ(index.segmentIndexAt(5.0), 4);
+  EXPECT_EQ(index.segmentIndexAt(10.0), 4);
+}
+
+TEST_F(ArcLengthIndexTest, NonUniformSampling) {
+  // One long segment followed by many short ones triggers the binary search
+  // fallback; the lookup result must not change.
+  DataRow arc_lengths(12);
+  arc_lengths << 0.0, 100.0, 100.1, 100.2, 100.3, 100.4, 100.5, 100.6, 100.7,
+      100.8, 100.9, 101.0;
+
+  ArcLengthIndex index;
+  index.build(arc_lengths);
+
+  EXPECT_EQ(index.segmentIndexAt(50.0), 0);
+  EXPECT_EQ(index.segmentIndexAt(100.05), 1);
+  EXPECT_EQ(index.segmentIndexAt(100.45), 5);
+  EXPECT_EQ(index.segmentIndexAt(100.95), 10);
+  EXPECT_EQ(index.segmentIndexAt(200.0), 10);
+}
+
+TEST_F(ArcLengthIndexTest, NonMonotonicSampling) {
+  // Unsorted arc-lengths fall back to the linear scan: the first segment
+  // whose end node lies behind the query is returned.
+  DataRow arc_lengths(4);
+  arc_lengths << 0.0, 2.0, 1.0, 3.0;
+
+  ArcLengthIndex index;
+  index.build(arc_lengths);
+
+  EXPECT_EQ(index.segmentIndexAt(0.5), 0);
+  EXPECT_EQ(index.segmentIndexAt(2.5), 2);
+  EXPECT_EQ(index.segmentIndexAt(5.0), 2);
+}
+
+TEST_F(ArcLengthIndexTest, DegenerateData) {
+  ArcLengthIndex index;
+  EXPECT_TRUE(index.empty());
+  EXPECT_EQ(index.segmentIndexAt(1.0), 0);
+
+  DataRow single(1);
+  single << 0.0;
+  index.build(single);
+  EXPECT_TRUE(index.empty());
+
+  DataRow arc_lengths(3);
+  arc_lengths << 0.0, 1.0, 2.0;
+  index.build(arc_lengths);
+  EXPECT_FALSE(index.empty());
+  index.clear();
+  EXPECT_TRUE(index.empty());
+}
@@ -3,6 +3,7 @@
 #include <cmath>
 
 #include "corridor/corridor.h"
+#include "corridor/corridor_sequence_cursor.h"
 #include "lanelet_mock.hpp"
 
 using namespace corridor;
@@ -62,6 +63,98 @@ TEST_F(CorridorTest, createStraightCorridor) {
   EXPECT_FLOAT_EQ(straight_corridor_.curvatureAt(expected_arclength_), 0.0);
 }
 
+TEST_F(CorridorTest, boundaryInfoAt) {
+  // The fused query matches the individual accessors
+  for (const RealType arc_length :
+       {0.0, expected_arclength_ / 3.0, expected_arclength_}) {
+    const BoundaryInfo info = straight_corridor_.boundaryInfoAt(arc_length);
+    const BoundaryDistances distances =
+        straight_corridor_.signedDistancesAt(arc_length);
+    EXPECT_FLOAT_EQ(info.distance_left, distances.first);
+    EXPECT_FLOAT_EQ(info.distance_right, distances.second);
+    EXPECT_FLOAT_EQ(info.width, straight_corridor_.widthAt(arc_length));
+    EXPECT_FLOAT_EQ(info.center_offset,
+                    straight_corridor_.centerOffset(arc_length));
+  }
+}
+
+TEST_F(CorridorTest, distanceBoundPrefilter) {
+  // The straight corridor runs along y = x; the bound never overestimates
+  // the true distance to the reference line
+  for (const RealType offset : {0.0, 0.5, 2.0, 10.0, 50.0}) {
+    const CartesianPoint2D point(3.0 - offset * M_SQRT1_2,
+                                 3.0 + offset * M_SQRT1_2);
+    const RealType bound = straight_corridor_.minDistanceBound(point);
+    const auto projection = straight_corridor_.getFrenetPositionWithFrame(point);
+    EXPECT_LE(bound, std::abs(projection.position.d()) + 1e-6)
+        << "offset " << offset;
+  }
+
+  // Points inside the corridor are never rejected ...
+  EXPECT_TRUE(straight_corridor_.canContainPoint({3.0, 3.0}));
+  EXPECT_TRUE(straight_corridor_.canContainPoint({2.5, 3.5}));
+  // ... while far-away points are rejected without a projection
+  EXPECT_FALSE(straight_corridor_.canContainPoint({3.0 - 50.0, 3.0 + 50.0}));
+  EXPECT_GT(straight_corridor_.minDistanceBound({3.0 - 50.0, 3.0 + 50.0}),
+            40.0);
+  // The margin widens the acceptance band
+  const CartesianPoint2D near_miss(3.0 - 5.0 * M_SQRT1_2,
+                                   3.0 + 5.0 * M_SQRT1_2);
+  EXPECT_FALSE(straight_corridor_.canContainPoint(near_miss));
+  EXPECT_TRUE(straight_corridor_.canContainPoint(near_miss, 10.0));
+}
+
+TEST_F(CorridorTest, createCorridorFromPointViews) {
+  // Pack the lanelet polylines into contiguous buffers, as a map layer
+  // would hold them, and construct the corridor from non-owning views
+  const auto to_buffer = [](const CartesianPoints2D& points) {
+    CartesianPointsMatrix2D buffer(2, points.size());
+    for (std::size_t i = 0; i < points.size(); i++) {
+      buffer.col(i) = points[i];
+    }
+    return buffer;
+  };
+  const CartesianPointsMatrix2D reference_buffer =
+      to_buffer(straight_lanelet_.centerline);
+  const CartesianPointsMatrix2D left_buffer =
+      to_buffer(straight_lanelet_.left_boundary);
+  const CartesianPointsMatrix2D right_buffer =
+      to_buffer(straight_lanelet_.right_boundary);
+
+  const Corridor view_corridor(
+      id_,
+      CartesianPointsView2D(reference_buffer.data(), 2,
+                            reference_buffer.cols()),
+      CartesianPointsView2D(left_buffer.data(), 2, left_buffer.cols()),
+      CartesianPointsView2D(right_buffer.data(), 2, right_buffer.cols()));
+
+  EXPECT_EQ(view_corridor.id(), id_);
+  EXPECT_FLOAT_EQ(view_corridor.lengthReferenceLine(),
+                  straight_corridor_.lengthReferenceLine());
+  for (const RealType arc_length :
+       {0.0, expected_arclength_ / 3.0, expected_arclength_}) {
+    EXPECT_FLOAT_EQ(view_corridor.widthAt(arc_length),
+                    straight_corridor_.widthAt(arc_length));
+    EXPECT_FLOAT_EQ(view_corridor.centerOffset(arc_length),
+                    straight_corridor_.centerOffset(arc_length));
+  }
+}
+
+TEST_F(CorridorTest, createCorridorFromMovedParts) {
+  cubic_spline::CubicSpline reference_line(id_, straight_lanelet_.centerline);
+  FrenetPolyline left_bound =
+      reference_line.toFrenetPolyline(straight_lanelet_.left_boundary);
+  FrenetPolyline right_bound =
+      reference_line.toFrenetPolyline(straight_lanelet_.right_boundary);
+
+  const Corridor moved_corridor(std::move(reference_line),
+                                std::move(left_bound), std::move(right_bound));
+  EXPECT_EQ(moved_corridor.id(), id_);
+  EXPECT_FLOAT_EQ(moved_corridor.lengthReferenceLine(), expected_arclength_);
+  EXPECT_FLOAT_EQ(moved_corridor.widthAt(expected_arclength_ / 2.0),
+                  2 * M_SQRT2);
+}
+
 TEST_F(CorridorTest, frenetStateTransformation) {
   CartesianPoint2D position(4.0, 3.0);
   FrenetFrame2D frenet_frame = straight_corridor_.FrenetFrame(position);
@@ -94,6 +187,14 @@ TEST_F(CorridorTest, testCorridorSequence) {
   EXPECT_FLOAT_EQ(corridor_sequence.signedDistancesAt(18).second, -2.0);
   EXPECT_FLOAT_EQ(corridor_sequence.widthAt(18), 4.0);
 
+  // Monotone query sweep (planner pattern) hits the last-match cursor;
+  // jumping backwards afterwards falls back to the binary search
+  for (RealType arc_length = 10.0; arc_length <= 20.0; arc_length += 0.5) {
+    EXPECT_FLOAT_EQ(corridor_sequence.widthAt(arc_length), 4.0);
+  }
+  EXPECT_FLOAT_EQ(corridor_sequence.widthAt(0.0), 4.0);
+  EXPECT_FLOAT_EQ(corridor_sequence.widthAt(18.0), 4.0);
+
   // Test FrenetFrame conversion with different start arc_length which results
   // in different start corridors within the corridor sequence
   const CartesianPoint2D position(2, 0.4);
@@ -129,4 +230,80 @@ TEST_F(CorridorTest, testCorridorSequence) {
       corridor_sequence.getFrenetPositionWithFrame(position2, -100.0);
   EXPECT_EQ(frenet_data7.frame.frenet_base().id, 2);
   EXPECT_EQ(frenet_data7.frame.frenet_base().segment_info.idx, 1);
-}
\ No newline at end of file
+}
+
+TEST_F(CorridorTest, testCorridorSequenceCursor) {
+  const auto first_corridor_ptr = std::make_shared<Corridor>(
+      1, first_lanelet_.centerline, first_lanelet_.left_boundary,
+      first_lanelet_.right_boundary);
+  const auto second_corridor_ptr = std::make_shared<Corridor>(
+      2, second_lanelet_.centerline, second_lanelet_.left_boundary,
+      second_lanelet_.right_boundary);
+  CorridorSequence corridor_sequence({first_corridor_ptr, second_corridor_ptr});
+
+  // A tracked object moving along the sequence: the cursor result matches
+  // the stateless sequence query at every step, including the corridor
+  // change
+  CorridorSequenceCursor cursor(&corridor_sequence);
+  for (RealType x = 0.3; x < 19.0; x += 0.5) {
+    const CartesianPoint2D position(x, 0.3);
+    const FrenetPositionWithFrame from_cursor = cursor.project(position);
+    const FrenetPositionWithFrame from_sequence =
+        corridor_sequence.getFrenetPositionWithFrame(position, x);
+    EXPECT_EQ(from_cursor.frame.frenet_base().id,
+              from_sequence.frame.frenet_base().id);
+    EXPECT_FLOAT_EQ(from_cursor.position.l(), from_sequence.position.l());
+    EXPECT_FLOAT_EQ(from_cursor.position.d(), from_sequence.position.d());
+  }
+
+  // After a reset the cursor starts cold from the sequence front again
+  cursor.reset();
+  const CartesianPoint2D position(16.0, -1.7);
+  const FrenetPositionWithFrame cold = cursor.project(position);
+  EXPECT_EQ(cold.frame.frenet_base().id, 2);
+}
+TEST_F(CorridorTest, batchFrenetToCartesianConversion) {
+  FrenetPoints2D frenet_points;
+  for (RealType l = 0.0; l <= expected_arclength_; l += 0.4) {
+    frenet_points.emplace_back(FrenetPoint2D(expected_arclength_ - l, 0.3 * l));
+  }
+
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> cartesian_points;
+  const auto num_points = straight_corridor_.toCartesianPolyline(
+      frenet_points, &cartesian_points);
+  ASSERT_EQ(num_points, static_cast<cubic_spline::DataSize>(
+                            frenet_points.size()));
+
+  // The batched conversion matches the per-point conversion
+  for (cubic_spline::DataSize i = 0; i < num_points; i++) {
+    const CartesianPoint2D expected =
+        straight_corridor_.toCartesianPoint(frenet_points[i]);
+    EXPECT_NEAR(cartesian_points(0, i), expected.x(), 1e-9);
+    EXPECT_NEAR(cartesian_points(1, i), expected.y(), 1e-9);
+  }
+}
+
+TEST_F(CorridorTest, batchPolylineSampling) {
+  const RealType delta_l = 0.1;
+  CartesianPoints2D reference_polyline, left_polyline, right_polyline;
+  straight_corridor_.fillCartesianPolylines(&reference_polyline, &left_polyline,
+                                            &right_polyline, delta_l);
+
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> reference_buffer, left_buffer,
+      right_buffer;
+  const auto num_samples = straight_corridor_.sampleCartesianPolylines(
+      delta_l, &reference_buffer, &left_buffer, &right_buffer);
+
+  ASSERT_EQ(num_samples, static_cast<int>(reference_polyline.size()));
+  ASSERT_EQ(left_buffer.cols(), num_samples);
+  ASSERT_EQ(right_buffer.cols(), num_samples);
+
+  for (int i = 0; i < num_samples; i++) {
+    EXPECT_NEAR(reference_buffer(0, i), reference_polyline[i].x(), 1e-9);
+    EXPECT_NEAR(reference_buffer(1, i), reference_polyline[i].y(), 1e-9);
+    EXPECT_NEAR(left_buffer(0, i), left_polyline[i].x(), 1e-9);
+    EXPECT_NEAR(left_buffer(1, i), left_polyline[i].y(), 1e-9);
+    EXPECT_NEAR(right_buffer(0, i), right_polyline[i].x(), 1e-9);
+    EXPECT_NEAR(right_buffer(1, i), right_polyline[i].y(), 1e-9);
+  }
+}
@@ -0,0 +1,262 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "corridor/corridor_assignment/corridor_assignment.h"
+#include "corridor/corridor_assignment/corridor_assignment_cache.h"
+#include "corridor/internal/math.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+
+class CorridorAssignmentTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    corridors_.emplace_back(std::make_shared<Corridor>(
+        1, first_lanelet_.centerline, first_lanelet_.left_boundary,
+        first_lanelet_.right_boundary));
+    corridors_.emplace_back(std::make_shared<Corridor>(
+        2, second_lanelet_.centerline, second_lanelet_.left_boundary,
+        second_lanelet_.right_boundary));
+    corridors_.emplace_back(std::make_shared<Corridor>(
+        3, straight_lanelet_.centerline, straight_lanelet_.left_boundary,
+        straight_lanelet_.right_boundary));
+
+    // Objects spread along and beside the corridors
+    for (int i = 0; i < 7; i++) {
+      const RealType x = 2.5 * static_cast<RealType>(i);
+      const RealType y = (i % 2 == 0) ? 0.3 : -2.5;
+      cartesian_states_.emplace_back(
+          CartesianPoint2D(x, y), CartesianVector2D(1.0, 0.0),
+          CovarianceMatrix2D(0.4, 0.4), CovarianceMatrix2D(0.1, 0.1));
+      oriented_bounding_boxes_.emplace_back(0.0, 4.0, 2.0);
+    }
+  }
+
+ public:
+  StraightLanelet straight_lanelet_;
+  FirstStraightLaneletSection first_lanelet_;
+  SecondStraightLaneletSection second_lanelet_;
+
+  CorridorPtrs corridors_;
+  std::vector<CartesianState2D> cartesian_states_;
+  std::vector<OrientedBoundingBox> oriented_bounding_boxes_;
+};
+
+TEST_F(CorridorAssignmentTest, batchMatchesPairwiseEvaluation) {
+  AssignmentConfidenceMatrix confidences;
+  AssignObjectsToCorridors(cartesian_states_, oriented_bounding_boxes_,
+                           corridors_, &confidences);
+
+  ASSERT_EQ(confidences.rows(),
+            static_cast<Eigen::Index>(cartesian_states_.size()));
+  ASSERT_EQ(confidences.cols(), static_cast<Eigen::Index>(corridors_.size()));
+
+  // The batch engine reproduces the serial per-pair evaluation exactly
+  for (std::size_t i = 0; i < cartesian_states_.size(); i++) {
+    for (std::size_t j = 0; j < corridors_.size(); j++) {
+      const CorridorRelatedFeatures features =
+          ComputeCorridorRelatedObjectFeature(cartesian_states_[i],
+                                              oriented_bounding_boxes_[i],
+                                              *corridors_[j]);
+      const RealType expected = ComputeAssignmentConfidence(features);
+      EXPECT_DOUBLE_EQ(confidences(i, j), expected);
+      // The integral evaluation may undershoot zero by floating-point noise
+      EXPECT_GE(confidences(i, j), -1e-12);
+      EXPECT_LE(confidences(i, j), 1.0 + 1e-12);
+    }
+  }
+}
+
+TEST_F(CorridorAssignmentTest, threadCountDoesNotChangeResults) {
+  AssignmentConfidenceMatrix serial, parallel;
+  AssignObjectsToCorridors(cartesian_states_, oriented_bounding_boxes_,
+                           corridors_, &serial, 1);
+  AssignObjectsToCorridors(cartesian_states_, oriented_bounding_boxes_,
+                           corridors_, &parallel, 4);
+  ASSERT_EQ(serial.rows(), parallel.rows());
+  ASSERT_EQ(serial.cols(), parallel.cols());
+  EXPECT_TRUE(serial.isApprox(parallel));
+}
+
+TEST_F(CorridorAssignmentTest, gaussianIntegralKernelsAgree) {
+  // The std::erf production kernel matches the boost reference kernel over
+  // a broad parameter sweep
+  for (RealType m : {-0.5, 0.0, 0.25, 2.0}) {
+    for (RealType x : {-4.0, -0.3, 0.0, 1.7, 8.0}) {
+      for (RealType sigma : {1e-3, 0.2, 1.0, 5.0}) {
+        const RealType fast = math::evaluateIntegralLineWidthGaussianErf(
+            m, 0.5, x, sigma, -2.0, 3.0);
+        const RealType reference =
+            math::evaluateIntegralLineWidthGaussianBoost(m, 0.5, x, sigma,
+                                                         -2.0, 3.0);
+        EXPECT_NEAR(fast, reference, 1e-12);
+      }
+    }
+  }
+}
+
+TEST_F(CorridorAssignmentTest, gaussianIntegralBatchVariant) {
+  const std::size_t n = 32;
+  std::vector<RealType> m(n), b(n), x(n), sigma(n), lower(n), upper(n),
+      results(n);
+  for (std::size_t i = 0; i < n; i++) {
+    const RealType t = static_cast<RealType>(i);
+    m[i] = 0.1 * t - 1.0;
+    b[i] = 0.5;
+    x[i] = 0.3 * t - 4.0;
+    sigma[i] = 0.1 + 0.05 * t;
+    lower[i] = -2.0 - 0.1 * t;
+    upper[i] = 1.0 + 0.2 * t;
+  }
+  math::evaluateIntegralLineWidthGaussian(n, m.data(), b.data(), x.data(),
+                                          sigma.data(), lower.data(),
+                                          upper.data(), results.data());
+  for (std::size_t i = 0; i < n; i++) {
+    EXPECT_DOUBLE_EQ(results[i], math::evaluateIntegralLineWidthGaussianErf(
+                                     m[i], b[i], x[i], sigma[i], lower[i],
+                                     upper[i]));
+  }
+}
+
+TEST_F(CorridorAssignmentTest, lazyFeaturesMatchEagerComputation) {
+  const CartesianState2D state(CartesianPoint2D(4.0, -1.2),
+                               CartesianVector2D(2.0, 0.3),
+                               CovarianceMatrix2D(0.4, 0.4),
+                               CovarianceMatrix2D(0.1, 0.1));
+  const OrientedBoundingBox obb(0.2, 4.0, 2.0);
+  const Corridor& corridor = *corridors_.front();
+
+  const CorridorRelatedFeatures eager =
+      ComputeCorridorRelatedObjectFeature(state, obb, corridor);
+
+  // Every lazy confidence overload reproduces the struct-based result
+  const LazyCorridorRelatedFeatures lazy(state, obb, corridor);
+  EXPECT_DOUBLE_EQ(LateralAssignmentConfidence(lazy),
+                   LateralAssignmentConfidence(eager));
+  EXPECT_DOUBLE_EQ(LeftOfLateralAssignmentConfidence(lazy),
+                   LeftOfLateralAssignmentConfidence(eager));
+  EXPECT_DOUBLE_EQ(RightOfLateralAssignmentConfidence(lazy),
+                   RightOfLateralAssignmentConfidence(eager));
+  EXPECT_DOUBLE_EQ(LongitudinalAssignmentConfidence(lazy),
+                   LongitudinalAssignmentConfidence(eager));
+  EXPECT_DOUBLE_EQ(DownstreamLongitudinalAssignmentConfidence(lazy),
+                   DownstreamLongitudinalAssignmentConfidence(eager));
+  EXPECT_DOUBLE_EQ(UpstreamLongitudinalAssignmentConfidence(lazy),
+                   UpstreamLongitudinalAssignmentConfidence(eager));
+  EXPECT_DOUBLE_EQ(ComputeAssignmentConfidence(lazy),
+                   ComputeAssignmentConfidence(eager));
+
+  // The materialized struct matches the eager one field by field
+  const CorridorRelatedFeatures& materialized = lazy.features();
+  EXPECT_DOUBLE_EQ(materialized.corridor_width, eager.corridor_width);
+  EXPECT_DOUBLE_EQ(materialized.corridor_length, eager.corridor_length);
+  EXPECT_DOUBLE_EQ(materialized.corridor_center_offset,
+                   eager.corridor_center_offset);
+  EXPECT_DOUBLE_EQ(materialized.frenet_frame.arc_length(),
+                   eager.frenet_frame.arc_length());
+
+  // A lone gating query on a fresh view works without the other groups
+  const LazyCorridorRelatedFeatures gating_view(state, obb, corridor);
+  EXPECT_DOUBLE_EQ(LeftOfLateralAssignmentConfidence(gating_view),
+                   LeftOfLateralAssignmentConfidence(eager));
+}
+
+TEST_F(CorridorAssignmentTest, temporalFeatureCache) {
+  CorridorAssignmentCache cache;
+  const IdType track_id = 42;
+  const OrientedBoundingBox obb(0.0, 4.0, 2.0);
+
+  // A track creeping along the first corridor: the warm-started cached
+  // features match the from-scratch computation in every cycle (the mock
+  // corridors have constant width, so the boundary skip is exact)
+  for (int cycle = 0; cycle < 20; cycle++) {
+    const RealType x = 0.5 + 0.2 * static_cast<RealType>(cycle);
+    const CartesianState2D state(CartesianPoint2D(x, 0.3),
+                                 CartesianVector2D(1.0, 0.0),
+                                 CovarianceMatrix2D(0.4, 0.4),
+                                 CovarianceMatrix2D(0.1, 0.1));
+    const RealType cached =
+        cache.computeConfidence(track_id, state, obb, *corridors_.front());
+    const CorridorRelatedFeatures fresh_features =
+        ComputeCorridorRelatedObjectFeature(state, obb, *corridors_.front());
+    EXPECT_NEAR(cached, ComputeAssignmentConfidence(fresh_features), 1e-12);
+  }
+  EXPECT_EQ(cache.size(), 1u);
+
+  // Separate entries per (track, corridor) pair; forgetting a track drops
+  // only its entries
+  const CartesianState2D state(CartesianPoint2D(12.0, 0.0),
+                               CartesianVector2D(1.0, 0.0),
+                               CovarianceMatrix2D(0.4, 0.4),
+                               CovarianceMatrix2D(0.1, 0.1));
+  cache.computeConfidence(track_id, state, obb, *corridors_[1]);
+  cache.computeConfidence(7, state, obb, *corridors_[1]);
+  EXPECT_EQ(cache.size(), 3u);
+  cache.forgetTrack(track_id);
+  EXPECT_EQ(cache.size(), 1u);
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0u);
+}
+
+TEST_F(CorridorAssignmentTest, fusedTriplesMatchIndividualConfidences) {
+  // Box dimensions cover all case branches: point-like, narrower and wider
+  // than the corridor (lateral), shorter and longer than it (longitudinal)
+  std::vector<OrientedBoundingBox> boxes;
+  boxes.emplace_back(0.0, 0.0, 0.0);
+  boxes.emplace_back(0.0, 4.0, 2.0);
+  boxes.emplace_back(0.2, 1.5, 8.0);
+  boxes.emplace_back(0.0, 30.0, 1.0);
+
+  for (const auto& state : cartesian_states_) {
+    for (const auto& box : boxes) {
+      for (const auto& corridor : corridors_) {
+        const CorridorRelatedFeatures features =
+            ComputeCorridorRelatedObjectFeature(state, box, *corridor);
+
+        // The fused triples share the Gaussian bound evaluations but must
+        // reproduce the individual functions exactly
+        const LateralConfidenceTriple lateral =
+            LateralAssignmentConfidences(features);
+        EXPECT_DOUBLE_EQ(lateral.inside,
+                         LateralAssignmentConfidence(features));
+        EXPECT_DOUBLE_EQ(lateral.left_of,
+                         LeftOfLateralAssignmentConfidence(features));
+        EXPECT_DOUBLE_EQ(lateral.right_of,
+                         RightOfLateralAssignmentConfidence(features));
+
+        const LongitudinalConfidenceTriple longitudinal =
+            LongitudinalAssignmentConfidences(features);
+        EXPECT_DOUBLE_EQ(longitudinal.inside,
+                         LongitudinalAssignmentConfidence(features));
+        EXPECT_DOUBLE_EQ(longitudinal.upstream,
+                         UpstreamLongitudinalAssignmentConfidence(features));
+        EXPECT_DOUBLE_EQ(longitudinal.downstream,
+                         DownstreamLongitudinalAssignmentConfidence(features));
+
+        // For a point-like object the lateral triple partitions the
+        // probability mass (up to the far-field truncation of the side
+        // integrals at +-100 m); wider objects overlap the ramps, so the
+        // identity only holds for the first box
+        if (features.frenet_obb.projectionX2() <
+            std::numeric_limits<RealType>::epsilon()) {
+          EXPECT_NEAR(lateral.right_of + lateral.inside + lateral.left_of,
+                      1.0, 1e-6);
+        }
+      }
+    }
+  }
+}
+
+TEST_F(CorridorAssignmentTest, emptyInputs) {
+  AssignmentConfidenceMatrix confidences;
+  AssignObjectsToCorridors({}, {}, corridors_, &confidences);
+  EXPECT_EQ(confidences.rows(), 0);
+  EXPECT_EQ(confidences.cols(), static_cast<Eigen::Index>(corridors_.size()));
+
+  AssignObjectsToCorridors(cartesian_states_, oriented_bounding_boxes_,
+                           CorridorPtrs(), &confidences);
+  EXPECT_EQ(confidences.rows(),
+            static_cast<Eigen::Index>(cartesian_states_.size()));
+  EXPECT_EQ(confidences.cols(), 0);
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "corridor/corridor_builder.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+
+class CorridorBuilderTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    straight_data_.id = 1;
+    straight_data_.reference_line_pts = straight_lanelet_.centerline;
+    straight_data_.left_boundary_pts = straight_lanelet_.left_boundary;
+    straight_data_.right_boundary_pts = straight_lanelet_.right_boundary;
+
+    curved_data_.id = 2;
+    curved_data_.reference_line_pts = curved_lanelet_.centerline;
+    curved_data_.left_boundary_pts = curved_lanelet_.left_boundary;
+    curved_data_.right_boundary_pts = curved_lanelet_.right_boundary;
+  }
+
+ public:
+  StraightLanelet straight_lanelet_;
+  CurvedLanelet curved_lanelet_;
+  CorridorConstructionData straight_data_;
+  CorridorConstructionData curved_data_;
+};
+
+TEST_F(CorridorBuilderTest, singleCorridor) {
+  const CorridorPtr built = BuildCorridor(straight_data_);
+  const Corridor reference(straight_data_.id,
+                           straight_data_.reference_line_pts,
+                           straight_data_.left_boundary_pts,
+                           straight_data_.right_boundary_pts);
+
+  ASSERT_NE(built, nullptr);
+  EXPECT_EQ(built->id(), reference.id());
+  EXPECT_FLOAT_EQ(built->lengthReferenceLine(),
+                  reference.lengthReferenceLine());
+
+  const RealType total_length = reference.lengthReferenceLine();
+  for (RealType l = 0.0; l <= total_length; l += 0.5) {
+    EXPECT_FLOAT_EQ(built->widthAt(l), reference.widthAt(l));
+    EXPECT_FLOAT_EQ(built->centerOffset(l), reference.centerOffset(l));
+  }
+}
+
+TEST_F(CorridorBuilderTest, corridorBatch) {
+  // Many corridors, built across worker threads, must match the sequential
+  // construction one by one
+  CorridorConstructionDataVector batch;
+  for (int i = 0; i < 16; i++) {
+    CorridorConstructionData data = (i % 2 == 0) ? straight_data_ : curved_data_;
+    data.id = i;
+    batch.push_back(data);
+  }
+
+  const CorridorPtrs corridors = BuildCorridors(batch, 4);
+  ASSERT_EQ(corridors.size(), batch.size());
+  for (std::size_t i = 0; i < batch.size(); i++) {
+    const Corridor reference(batch[i].id, batch[i].reference_line_pts,
+                             batch[i].left_boundary_pts,
+                             batch[i].right_boundary_pts);
+    ASSERT_NE(corridors[i], nullptr);
+    EXPECT_EQ(corridors[i]->id(), reference.id());
+    EXPECT_FLOAT_EQ(corridors[i]->lengthReferenceLine(),
+                    reference.lengthReferenceLine());
+    const RealType mid = 0.5 * reference.lengthReferenceLine();
+    EXPECT_FLOAT_EQ(corridors[i]->widthAt(mid), reference.widthAt(mid));
+  }
+
+  // Empty batch and single-thread fallback
+  EXPECT_TRUE(BuildCorridors({}).empty());
+  const CorridorPtrs sequential = BuildCorridors(batch, 1);
+  ASSERT_EQ(sequential.size(), batch.size());
+  EXPECT_EQ(sequential.front()->id(), 0);
+}
@@ -0,0 +1,64 @@
+#include <gtest/gtest.h>
+
+#include "corridor/corridor_pool.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+
+class CorridorPoolTest : public ::testing::Test {
+ public:
+  StraightLanelet straight_lanelet_;
+  CurvedLanelet curved_lanelet_;
+};
+
+TEST_F(CorridorPoolTest, constructAndQuery) {
+  CorridorPool pool;
+  EXPECT_TRUE(pool.empty());
+
+  const CorridorHandle straight = pool.construct(
+      1, straight_lanelet_.centerline, straight_lanelet_.left_boundary,
+      straight_lanelet_.right_boundary);
+  const CorridorHandle curved = pool.construct(
+      2, curved_lanelet_.centerline, curved_lanelet_.left_boundary,
+      curved_lanelet_.right_boundary);
+
+  EXPECT_FALSE(pool.empty());
+  EXPECT_EQ(pool.size(), 2);
+  EXPECT_EQ(straight->id(), 1);
+  EXPECT_EQ(curved->id(), 2);
+  EXPECT_FLOAT_EQ(straight->lengthReferenceLine(), M_SQRT2 * 6);
+}
+
+TEST_F(CorridorPoolTest, handlesStayValidWhilePoolGrows) {
+  CorridorPool pool;
+  CorridorHandlePath path;
+  for (int i = 0; i < 100; i++) {
+    path.emplace_back(pool.construct(i, straight_lanelet_.centerline,
+                                     straight_lanelet_.left_boundary,
+                                     straight_lanelet_.right_boundary));
+  }
+
+  // Growing the pool must not move already pooled corridors
+  EXPECT_EQ(pool.size(), 100);
+  for (int i = 0; i < 100; i++) {
+    EXPECT_EQ(path[i]->id(), i);
+  }
+
+  // Paths over handles are cheap to copy and discard
+  CorridorHandlePaths paths(10, path);
+  EXPECT_EQ(paths.back().front()->id(), 0);
+  EXPECT_EQ(paths.back().back()->id(), 99);
+}
+
+TEST_F(CorridorPoolTest, moveIntoPool) {
+  CorridorPool pool;
+  Corridor corridor(7, straight_lanelet_.centerline,
+                    straight_lanelet_.left_boundary,
+                    straight_lanelet_.right_boundary);
+  const CorridorHandle handle = pool.add(std::move(corridor));
+  EXPECT_EQ(pool.size(), 1);
+  EXPECT_EQ(handle->id(), 7);
+
+  pool.clear();
+  EXPECT_TRUE(pool.empty());
+}
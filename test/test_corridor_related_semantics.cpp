@@ -2,7 +2,9 @@
 
 #include <cmath>
 
+#include "corridor/corridor_assignment/corridor_assignment.h"
 #include "corridor/corridor_assignment/corridor_related_semantics.h"
+#include "corridor/corridor_assignment/relative_direction_lookup_table.h"
 
 using namespace corridor;
 
@@ -60,4 +62,43 @@ TEST(CorridorRelatedSemantic, SemanticLabelPairsAboveOne) {
   EXPECT_FLOAT_EQ(semantic_labels.at(SemanticLabel::kDownstream), 0.06666667);
   EXPECT_FLOAT_EQ(semantic_labels.at(SemanticLabel::kTowardsLeft), 0.26666668);
   EXPECT_FLOAT_EQ(semantic_labels.at(SemanticLabel::kTowardsRight), 0.13333334);
+}
+
+TEST(CorridorRelatedSemantic, RelativeDirectionConfidence) {
+  // An object heading straight downstream with small uncertainty
+  const SemanticLabelSet labels =
+      RelativeDirectionConfidence({0.0, 0.05}, 1.0);
+  EXPECT_GT(labels.at(SemanticLabel::kDownstream), 0.95);
+  EXPECT_LT(labels.at(SemanticLabel::kUpstream), 1e-2);
+  EXPECT_LT(labels.at(SemanticLabel::kTowardsLeft), 1e-2);
+  EXPECT_LT(labels.at(SemanticLabel::kTowardsRight), 1e-2);
+
+  // Crossing towards the left side
+  const SemanticLabelSet crossing =
+      RelativeDirectionConfidence({M_PI_2, 0.05}, 1.0);
+  EXPECT_GT(crossing.at(SemanticLabel::kTowardsLeft), 0.95);
+  EXPECT_LT(crossing.at(SemanticLabel::kDownstream), 1e-2);
+}
+
+TEST(CorridorRelatedSemantic, DirectionLookupTableMatchesExactEvaluation) {
+  const RealType sigma_band = 1.0;
+  const RelativeDirectionLookupTable table(sigma_band);
+
+  const SemanticLabels all_labels{
+      SemanticLabel::kDownstream, SemanticLabel::kUpstream,
+      SemanticLabel::kTowardsLeft, SemanticLabel::kTowardsRight};
+
+  // The interpolated confidences stay within the 1e-3 classification
+  // tolerance of the exact integrals over the whole (heading, sigma) range
+  for (RealType heading = -M_PI; heading <= M_PI; heading += 0.17) {
+    for (RealType sigma : {0.01, 0.1, 0.4, 1.0, 2.5}) {
+      const SemanticLabelSet exact =
+          RelativeDirectionConfidence({heading, sigma}, sigma_band);
+      const SemanticLabelSet interpolated = table.labelSet({heading, sigma});
+      for (const SemanticLabel label : all_labels) {
+        EXPECT_NEAR(interpolated.at(label), exact.at(label), 1e-3)
+            << "heading " << heading << " sigma " << sigma;
+      }
+    }
+  }
 }
\ No newline at end of file
@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+
+#include "corridor/corridor_sequence_stream.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+
+class CorridorSequenceStreamTest : public ::testing::Test {
+ public:
+  CorridorSources makeRoute(const std::size_t num_corridors) const {
+    CorridorSources sources;
+    for (std::size_t i = 0; i < num_corridors; i++) {
+      sources.push_back({static_cast<IdType>(i + 1),
+                         straight_lanelet_.centerline,
+                         straight_lanelet_.left_boundary,
+                         straight_lanelet_.right_boundary});
+    }
+    return sources;
+  }
+
+  // Reference line length of one straight lanelet corridor
+  const RealType corridor_length_ = M_SQRT2 * 6;
+  StraightLanelet straight_lanelet_;
+};
+
+TEST_F(CorridorSequenceStreamTest, prefetchesWithinLookahead) {
+  // Lookahead of 10 m covers two of the ~8.5 m corridors
+  CorridorSequenceStream stream(makeRoute(6), 10.0);
+  stream.waitForHorizon();
+
+  EXPECT_EQ(stream.numConstructed(), 2);
+  EXPECT_FALSE(stream.exhausted());
+
+  const CorridorSequence& sequence = stream.update(0.0);
+  EXPECT_EQ(sequence.size(), 2);
+  EXPECT_FLOAT_EQ(sequence.totalLength(), 2 * corridor_length_);
+
+  // The spliced sequence is immediately queryable on the calling thread
+  const auto position_with_frame =
+      sequence.getFrenetPositionWithFrame(CartesianPoint2D(3.0, 3.0));
+  EXPECT_NEAR(position_with_frame.position.d(), 0.0, 1e-5);
+}
+
+TEST_F(CorridorSequenceStreamTest, advancingEgoExtendsSequence) {
+  CorridorSequenceStream stream(makeRoute(6), 10.0);
+  stream.waitForHorizon();
+  stream.update(0.0);
+  ASSERT_EQ(stream.sequence().size(), 2);
+
+  // Ego advances one corridor: the horizon moves and the prefetcher
+  // constructs ahead of it in the background
+  stream.update(corridor_length_);
+  stream.waitForHorizon();
+  const CorridorSequence& sequence = stream.update(corridor_length_);
+  EXPECT_EQ(sequence.size(), 3);
+  EXPECT_FLOAT_EQ(sequence.totalLength(), 3 * corridor_length_);
+
+  // Driving past the route end constructs and splices everything
+  stream.update(10 * corridor_length_);
+  stream.waitForHorizon();
+  stream.update(10 * corridor_length_);
+  EXPECT_TRUE(stream.exhausted());
+  EXPECT_EQ(stream.sequence().size(), 6);
+  EXPECT_FLOAT_EQ(stream.sequence().totalLength(), 6 * corridor_length_);
+}
+
+TEST_F(CorridorSequenceStreamTest, largeLookaheadConstructsWholeRoute) {
+  CorridorSequenceStream stream(makeRoute(4), 1000.0);
+  stream.waitForHorizon();
+  EXPECT_TRUE(stream.exhausted());
+  EXPECT_EQ(stream.numConstructed(), 4);
+
+  const CorridorSequence& sequence = stream.update(0.0);
+  EXPECT_EQ(sequence.size(), 4);
+  EXPECT_FLOAT_EQ(sequence.totalLength(), 4 * corridor_length_);
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstdio>
+
+#include "corridor/corridor_serialization.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+
+class CorridorSerializationTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    corridors_.emplace_back(std::make_shared<Corridor>(
+        1, straight_lanelet_.centerline, straight_lanelet_.left_boundary,
+        straight_lanelet_.right_boundary));
+    corridors_.emplace_back(std::make_shared<Corridor>(
+        2, curved_lanelet_.centerline, curved_lanelet_.left_boundary,
+        curved_lanelet_.right_boundary));
+    filename_ = ::testing::TempDir() + "corridor_serialization_test.bin";
+  }
+  void TearDown() override { std::remove(filename_.c_str()); }
+
+ public:
+  StraightLanelet straight_lanelet_;
+  CurvedLanelet curved_lanelet_;
+  CorridorPtrs corridors_;
+  std::string filename_;
+};
+
+TEST_F(CorridorSerializationTest, RoundTrip) {
+  ASSERT_TRUE(WriteCorridorsToBinaryFile(corridors_, filename_));
+
+  const CorridorPtrs loaded_corridors =
+      LoadCorridorsFromBinaryFile(filename_);
+  ASSERT_EQ(loaded_corridors.size(), corridors_.size());
+
+  for (std::size_t i = 0; i < corridors_.size(); i++) {
+    const Corridor& original = *corridors_[i];
+    const Corridor& loaded = *loaded_corridors[i];
+
+    EXPECT_EQ(loaded.id(), original.id());
+    EXPECT_FLOAT_EQ(loaded.lengthReferenceLine(),
+                    original.lengthReferenceLine());
+
+    // Queries on the loaded corridor behave exactly like on the original
+    const RealType total_length = original.lengthReferenceLine();
+    for (RealType arc_length = 0.0; arc_length <= total_length;
+         arc_length += 0.5) {
+      EXPECT_FLOAT_EQ(loaded.widthAt(arc_length),
+                      original.widthAt(arc_length));
+      EXPECT_FLOAT_EQ(loaded.curvatureAt(arc_length),
+                      original.curvatureAt(arc_length));
+    }
+
+    const CartesianPoint2D query_point(2.0, 1.0);
+    const auto original_position =
+        original.getFrenetPositionWithFrame(query_point);
+    const auto loaded_position = loaded.getFrenetPositionWithFrame(query_point);
+    EXPECT_FLOAT_EQ(loaded_position.position.l(),
+                    original_position.position.l());
+    EXPECT_FLOAT_EQ(loaded_position.position.d(),
+                    original_position.position.d());
+  }
+}
+
+TEST_F(CorridorSerializationTest, InvalidFiles) {
+  // Missing file
+  EXPECT_TRUE(LoadCorridorsFromBinaryFile("/nonexistent/corridors.bin").empty());
+
+  // Truncated file
+  ASSERT_TRUE(WriteCorridorsToBinaryFile(corridors_, filename_));
+  {
+    std::FILE* file = std::fopen(filename_.c_str(), "r+");
+    ASSERT_NE(file, nullptr);
+    ASSERT_EQ(std::fseek(file, 0, SEEK_END), 0);
+    const long file_size = std::ftell(file);
+    std::fclose(file);
+    ASSERT_EQ(::truncate(filename_.c_str(), file_size / 2), 0);
+  }
+  EXPECT_TRUE(LoadCorridorsFromBinaryFile(filename_).empty());
+}
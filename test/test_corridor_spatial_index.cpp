@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include "corridor/corridor_spatial_index.h"
+
+using namespace corridor;
+
+namespace {
+
+// Straight corridor along y = offset_y, x in [0, 10], 1m to each boundary
+CorridorPtr MakeStraightCorridor(const IdType id, const RealType offset_y) {
+  CartesianPoints2D reference_line;
+  for (int x = 0; x <= 10; x += 2) {
+    reference_line.emplace_back(static_cast<RealType>(x), offset_y);
+  }
+  return std::make_shared<Corridor>(id, reference_line, 1.0, 1.0);
+}
+
+}  // namespace
+
+class CorridorSpatialIndexTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    corridors_.emplace_back(MakeStraightCorridor(1, 0.0));
+    corridors_.emplace_back(MakeStraightCorridor(2, 3.0));
+    corridors_.emplace_back(MakeStraightCorridor(3, 50.0));
+  }
+
+ public:
+  CorridorPtrs corridors_;
+};
+
+TEST_F(CorridorSpatialIndexTest, emptyIndex) {
+  CorridorSpatialIndex index;
+  EXPECT_TRUE(index.empty());
+  EXPECT_EQ(index.size(), 0);
+  CartesianPoint2D point;
+  point << 0.0, 0.0;
+  EXPECT_TRUE(index.corridorCandidatesAt(point).empty());
+}
+
+TEST_F(CorridorSpatialIndexTest, candidateLookup) {
+  CorridorSpatialIndex index(corridors_, 5.0);
+  EXPECT_FALSE(index.empty());
+  EXPECT_EQ(index.size(), 3);
+
+  // Inside the first corridor only
+  CartesianPoint2D point;
+  point << 5.0, -0.5;
+  CorridorPtrs candidates = index.corridorCandidatesAt(point);
+  ASSERT_EQ(candidates.size(), 1);
+  EXPECT_EQ(candidates.front()->id(), 1);
+
+  // Inside the third (distant) corridor only
+  point << 5.0, 50.5;
+  candidates = index.corridorCandidatesAt(point);
+  ASSERT_EQ(candidates.size(), 1);
+  EXPECT_EQ(candidates.front()->id(), 3);
+
+  // Between the first and second corridor: both padded boxes contain it
+  point << 5.0, 1.5;
+  candidates = index.corridorCandidatesAt(point);
+  EXPECT_EQ(candidates.size(), 2);
+
+  // Far away from all corridors
+  point << 5.0, 25.0;
+  EXPECT_TRUE(index.corridorCandidatesAt(point).empty());
+  point << -100.0, 0.0;
+  EXPECT_TRUE(index.corridorCandidatesAt(point).empty());
+}
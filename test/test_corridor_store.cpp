@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+
+#include <thread>
+
+#include "corridor/corridor_store.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+
+class CorridorStoreTest : public ::testing::Test {
+ public:
+  std::deque<Corridor> makeCorridorSet(const IdType first_id,
+                                       const std::size_t count) const {
+    std::deque<Corridor> corridors;
+    for (std::size_t i = 0; i < count; i++) {
+      corridors.emplace_back(first_id + static_cast<IdType>(i),
+                             straight_lanelet_.centerline,
+                             straight_lanelet_.left_boundary,
+                             straight_lanelet_.right_boundary);
+    }
+    return corridors;
+  }
+
+  StraightLanelet straight_lanelet_;
+  CurvedLanelet curved_lanelet_;
+};
+
+TEST_F(CorridorStoreTest, publishAndQuery) {
+  CorridorStore store;
+
+  // A fresh store publishes an empty snapshot, never nullptr
+  const CorridorSnapshotPtr initial = store.snapshot();
+  ASSERT_NE(initial, nullptr);
+  EXPECT_TRUE(initial->empty());
+  EXPECT_EQ(initial->epoch(), 0);
+
+  const auto epoch = store.publish(makeCorridorSet(10, 3));
+  EXPECT_EQ(epoch, 1);
+
+  const CorridorSnapshotPtr snapshot = store.snapshot();
+  EXPECT_EQ(snapshot->size(), 3);
+  EXPECT_EQ(snapshot->epoch(), 1);
+  EXPECT_EQ(snapshot->at(0)->id(), 10);
+  EXPECT_EQ(snapshot->findById(12)->id(), 12);
+  EXPECT_EQ(snapshot->findById(99), nullptr);
+  EXPECT_FLOAT_EQ(snapshot->at(0)->lengthReferenceLine(), M_SQRT2 * 6);
+}
+
+TEST_F(CorridorStoreTest, oldSnapshotSurvivesRepublish) {
+  CorridorStore store;
+  store.publish(makeCorridorSet(1, 2));
+
+  const CorridorSnapshotPtr held = store.snapshot();
+  const CorridorHandle held_corridor = held->findById(1);
+  ASSERT_NE(held_corridor, nullptr);
+
+  // A map update replaces the published snapshot ...
+  store.publish(makeCorridorSet(100, 1));
+  EXPECT_EQ(store.snapshot()->findById(1), nullptr);
+  EXPECT_EQ(store.snapshot()->epoch(), 2);
+
+  // ... but a reader still holding the previous epoch keeps its corridors
+  // alive and fully usable
+  EXPECT_EQ(held->epoch(), 1);
+  EXPECT_EQ(held_corridor->id(), 1);
+  EXPECT_FLOAT_EQ(held_corridor->lengthReferenceLine(), M_SQRT2 * 6);
+}
+
+TEST_F(CorridorStoreTest, concurrentReadersDuringRepublish) {
+  CorridorStore store;
+  store.publish(makeCorridorSet(0, 4));
+
+  std::atomic<bool> done(false);
+  std::atomic<int> queries(0);
+  const auto reader = [&store, &done, &queries]() {
+    while (!done.load()) {
+      // One snapshot load per "cycle", then handle-based queries only
+      const CorridorSnapshotPtr snapshot = store.snapshot();
+      for (const CorridorHandle corridor : snapshot->handles()) {
+        const auto position_with_frame =
+            corridor->getFrenetPositionWithFrame(CartesianPoint2D(2.0, 2.5));
+        if (std::abs(position_with_frame.position.d()) < 10.0) {
+          queries++;
+        }
+      }
+    }
+  };
+
+  std::thread first_reader(reader);
+  std::thread second_reader(reader);
+  for (IdType update = 0; update < 50; update++) {
+    store.publish(makeCorridorSet(update * 10, 4));
+  }
+  done = true;
+  first_reader.join();
+  second_reader.join();
+
+  EXPECT_EQ(store.snapshot()->epoch(), 51);
+  EXPECT_GT(queries.load(), 0);
+}
+
+TEST_F(CorridorStoreTest, concurrentFirstBoundaryQueries) {
+  // Width and boundary queries go through the boundary polylines, whose
+  // arc-length lookup index must be built during corridor construction:
+  // several threads issuing their first boundary query on a freshly
+  // published corridor must not race on a lazy index build.
+  CorridorStore store;
+
+  for (IdType update = 0; update < 20; update++) {
+    store.publish(makeCorridorSet(update * 10, 4));
+    const CorridorSnapshotPtr snapshot = store.snapshot();
+
+    const auto reader = [&snapshot]() {
+      for (const CorridorHandle corridor : snapshot->handles()) {
+        const RealType width = corridor->widthAt(2.0);
+        EXPECT_GT(width, 0.0);
+        const BoundaryDistances distances = corridor->signedDistancesAt(2.0);
+        EXPECT_GT(distances.first, 0.0);
+        EXPECT_LT(distances.second, 0.0);
+      }
+    };
+
+    std::thread first_reader(reader);
+    std::thread second_reader(reader);
+    first_reader.join();
+    second_reader.join();
+  }
+}
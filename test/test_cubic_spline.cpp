@@ -54,6 +54,123 @@ TEST_F(CubicSplineTest, Evaluate) {  // NOLINT
   EXPECT_FLOAT_EQ(36.581856, cubic_spline.GetTotalLength());
 }
 
+TEST_F(CubicSplineTest, ConstructFromPointsView) {  // NOLINT
+  // Externally held buffer (one point per column), viewed without copying
+  CartesianPointsMatrix2D buffer(2, x_vec_.size());
+  for (std::size_t i = 0; i < x_vec_.size(); i++) {
+    buffer(0, i) = x_vec_[i];
+    buffer(1, i) = y_vec_[i];
+  }
+  const CartesianPointsView2D view(buffer.data(), 2, buffer.cols());
+
+  const CubicSpline view_spline(1, view);
+  const CubicSpline vector_spline(2, x_vec_, y_vec_);
+
+  ASSERT_EQ(view_spline.GetSize(), vector_spline.GetSize());
+  EXPECT_FLOAT_EQ(view_spline.GetTotalLength(),
+                  vector_spline.GetTotalLength());
+  for (RealType l = 0.0; l < vector_spline.GetTotalLength(); l += 0.5) {
+    const CartesianPoint2D delta =
+        view_spline.GetPositionAt(l) - vector_spline.GetPositionAt(l);
+    EXPECT_NEAR(delta.norm(), 0.0, 1e-12);
+  }
+
+  // A view with less than two points is rejected like an empty point vector
+  const CartesianPointsView2D short_view(buffer.data(), 2, 1);
+  const CubicSpline invalid_spline(3, short_view);
+  EXPECT_EQ(InvalidId, invalid_spline.GetId());
+}
+
+TEST_F(CubicSplineTest, BatchToCartesianPolyline) {  // NOLINT
+  const CubicSpline cubic_spline(1, x_vec_, y_vec_);
+  const RealType total_length = cubic_spline.GetTotalLength();
+
+  // Unordered queries with varying deviations, as a sampling planner would
+  // produce them
+  FrenetPoints2D frenet_points;
+  for (RealType l = 0.0; l <= total_length; l += 0.7) {
+    frenet_points.emplace_back(FrenetPoint2D(total_length - l,
+                                             0.5 * std::sin(l)));
+  }
+
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> cartesian_points;
+  const auto num_points =
+      cubic_spline.toCartesianPolyline(frenet_points, &cartesian_points);
+  ASSERT_EQ(num_points, static_cast<DataSize>(frenet_points.size()));
+
+  // The batched conversion matches the per-point evaluation
+  for (DataSize i = 0; i < num_points; i++) {
+    const FrenetPoint2D& query = frenet_points[i];
+    const CartesianPoint2D expected =
+        cubic_spline.GetPositionAt(query.l()) +
+        query.d() * cubic_spline.GetNormalVectorAt(query.l());
+    EXPECT_NEAR(cartesian_points(0, i), expected.x(), 1e-9);
+    EXPECT_NEAR(cartesian_points(1, i), expected.y(), 1e-9);
+  }
+}
+
+TEST_F(CubicSplineTest, Append) {  // NOLINT
+  // Long gently curved reference line, extended by a few points
+  CartesianPoints2D points;
+  for (int i = 0; i < 20; i++) {
+    points.emplace_back(static_cast<RealType>(i),
+                        std::sin(0.2 * static_cast<RealType>(i)));
+  }
+  CartesianPoints2D new_points;
+  for (int i = 20; i < 24; i++) {
+    new_points.emplace_back(static_cast<RealType>(i),
+                            std::sin(0.2 * static_cast<RealType>(i)));
+  }
+
+  CubicSpline incremental_spline(1, points);
+  ASSERT_TRUE(incremental_spline.append(new_points));
+
+  CartesianPoints2D all_points = points;
+  all_points.insert(all_points.end(), new_points.begin(), new_points.end());
+  const CubicSpline refitted_spline(2, all_points);
+
+  ASSERT_EQ(incremental_spline.GetSize(), refitted_spline.GetSize());
+  EXPECT_NEAR(incremental_spline.GetTotalLength(),
+              refitted_spline.GetTotalLength(), 1e-3);
+
+  // The incrementally extended spline matches the full refit up to the
+  // exponentially decayed moment residual at the refit window boundary
+  const RealType total_length = refitted_spline.GetTotalLength();
+  for (RealType l = 0.0; l < total_length; l += 0.5) {
+    const CartesianPoint2D delta = incremental_spline.GetPositionAt(l) -
+                                   refitted_spline.GetPositionAt(l);
+    EXPECT_NEAR(delta.norm(), 0.0, 1e-3);
+  }
+
+  // Appending to an empty spline constructs it from scratch
+  CubicSpline empty_spline(3);
+  ASSERT_TRUE(empty_spline.append(points));
+  EXPECT_EQ(empty_spline.GetSize(), 20);
+}
+
+TEST_F(CubicSplineTest, PopFront) {  // NOLINT
+  CubicSpline cubic_spline(23, x_vec_, y_vec_);
+  const RealType total_length = cubic_spline.GetTotalLength();
+  const RealType dropped_length = cubic_spline.GetArclengthAtIndex(2);
+  const CartesianPoint2D expected_position =
+      cubic_spline.GetPositionAt(dropped_length + 1.0);
+
+  ASSERT_TRUE(cubic_spline.popFront(2));
+  EXPECT_EQ(cubic_spline.GetSize(), 9);
+  EXPECT_FLOAT_EQ(cubic_spline.GetArclengthAtIndex(0), 0.0);
+  EXPECT_FLOAT_EQ(cubic_spline.GetTotalLength(),
+                  total_length - dropped_length);
+
+  // Remaining segments keep their exact shape
+  const CartesianPoint2D delta =
+      expected_position - cubic_spline.GetPositionAt(1.0);
+  EXPECT_NEAR(delta.norm(), 0.0, 1e-12);
+
+  // Dropping all but one node is rejected
+  EXPECT_FALSE(cubic_spline.popFront(8));
+  EXPECT_EQ(cubic_spline.GetSize(), 9);
+}
+
 TEST_F(CubicSplineTest, FrenetFrame) {  // NOLINT
   IdType id = 23;
   CubicSpline cubic_spline(id, x_vec_, y_vec_);
@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+
 #include "corridor/cubic_spline/cubic_interpolation_2d.h"
 #include "corridor/cubic_spline/cubic_spline_segment_root_finding.h"
 #include "corridor/cubic_spline/cubic_spline_utilities.h"
@@ -90,6 +92,100 @@ TEST_F(CubicSplineUtilitiesTest, FindProjectionArcLength) {  // NOLINT
   }
 }
 
+TEST_F(CubicSplineUtilitiesTest, PolynomialRootsProjection) {  // NOLINT
+  DataMatrix<RealType> data = NaturalSplineDataMatrixFromPoints(refline_);
+
+  SegmentInfoVector<DataIdx, RealType> segment_candidates;
+  const bool matched = FindSegmentCandidates(data, point_, &segment_candidates);
+  ASSERT_TRUE(matched);
+
+  for (auto& segment : segment_candidates) {
+    const DataSegment<RealType>& data_segment =
+        data.block<kSize, 2>(kPoint_x, segment.idx);
+    const Coefficients2d segment_coeffs(data_segment.col(0),
+                                        data_segment.col(1));
+
+    const auto polynomial = PolynomialRootsMethod(
+        segment_coeffs, segment.relative_arc_length, point_);
+    ASSERT_TRUE(polynomial.first);
+
+    if (segment.idx == 4) {
+      // Brent fails here (root at the segment endpoint, no sign change), the
+      // direct solver finds the endpoint root itself.
+      EXPECT_NEAR(polynomial.second, segment_coeffs.max_length, 2e-3);
+      continue;
+    }
+    const auto brent =
+        BrentsMethod(segment_coeffs, segment.relative_arc_length, point_);
+    ASSERT_TRUE(brent.first);
+    EXPECT_NEAR(polynomial.second, brent.second, 2e-3);
+  }
+
+  // Both methods agree when used through FindProjectionOnSegment
+  for (const auto& segment : segment_candidates) {
+    const DataSegment<RealType>& data_segment =
+        data.block<kSize, 2>(kPoint_x, segment.idx);
+    SegmentInfo<DataIdx, RealType> brent_info = segment;
+    SegmentInfo<DataIdx, RealType> polynomial_info = segment;
+    ASSERT_TRUE(FindProjectionOnSegment(data_segment, &brent_info, point_,
+                                        g_epsilon_projection,
+                                        ProjectionMethod::kBrent));
+    ASSERT_TRUE(FindProjectionOnSegment(data_segment, &polynomial_info, point_,
+                                        g_epsilon_projection,
+                                        ProjectionMethod::kPolynomial));
+    EXPECT_NEAR(brent_info.relative_arc_length,
+                polynomial_info.relative_arc_length, 2e-3);
+  }
+}
+
+TEST_F(CubicSplineUtilitiesTest, SingleResultProjection) {  // NOLINT
+  DataMatrix<RealType> data = NaturalSplineDataMatrixFromPoints(refline_);
+  const SplineCoefficients2d coefficients =
+      SplineCoefficientsFromDataMatrix(data);
+
+  const auto smallest_deviation = [](const FrenetPositionWithFrame& a,
+                                     const FrenetPositionWithFrame& b) {
+    return a.position.d_value() < b.position.d_value();
+  };
+
+  // Reference: allocating path with smallest-deviation selection
+  FrenetPositionsWithFrames frenet_data =
+      ConstructFrenetPositionsWithFrames(data, coefficients, point_, 23);
+  const auto reference = *std::min_element(frenet_data.begin(),
+                                           frenet_data.end(),
+                                           smallest_deviation);
+
+  FrenetPositionWithFrame result;
+  ASSERT_TRUE(
+      ConstructFrenetPositionWithFrame(data, coefficients, point_, &result, 23));
+  EXPECT_FLOAT_EQ(result.position.l(), reference.position.l());
+  EXPECT_FLOAT_EQ(result.position.d(), reference.position.d());
+  EXPECT_EQ(result.frame.frenet_base().segment_info.idx,
+            reference.frame.frenet_base().segment_info.idx);
+
+  // With an arc-length hint the candidate closest to the hint wins
+  FrenetPositionWithFrame hinted;
+  ASSERT_TRUE(ConstructFrenetPositionWithFrame(data, coefficients, point_,
+                                               &hinted, 23, 18.0));
+  EXPECT_EQ(hinted.frame.frenet_base().segment_info.idx, 4);
+
+  // Point below the heart tip lies before the spline start and behind its
+  // end at the same time; both paths must agree on the clamped match
+  CartesianPoint2D outside_point;
+  outside_point << 0.f, -8.f;
+  FrenetPositionsWithFrames outside_data =
+      ConstructFrenetPositionsWithFrames(data, coefficients, outside_point, 23);
+  const auto outside_reference = *std::min_element(
+      outside_data.begin(), outside_data.end(), smallest_deviation);
+
+  FrenetPositionWithFrame outside_result;
+  ASSERT_TRUE(ConstructFrenetPositionWithFrame(data, coefficients,
+                                               outside_point, &outside_result,
+                                               23));
+  EXPECT_FLOAT_EQ(outside_result.position.l(), outside_reference.position.l());
+  EXPECT_FLOAT_EQ(outside_result.position.d(), outside_reference.position.d());
+}
+
 TEST_F(CubicSplineUtilitiesTest, FrenetFrame) {  // NOLINT
   DataMatrix<RealType> data = NaturalSplineDataMatrixFromPoints(refline_);
 
@@ -133,3 +229,64 @@ TEST_F(CubicSplineUtilitiesTest, FrenetFrame) {  // NOLINT
   expected << 0.631432, 0.775431;
   EXPECT_NEAR((expected - ff3.normal()).norm(), 0.f, 1e-5);
 }
+
+TEST_F(CubicSplineUtilitiesTest, DecimatePoints) {  // NOLINT
+  // Oversampled straight line collapses to its end points
+  CartesianPoints2D straight_line;
+  for (int i = 0; i <= 50; i++) {
+    straight_line.emplace_back(0.2 * i, 0.2 * i);
+  }
+  const auto decimated_line = DecimatePoints(straight_line, 0.05);
+  ASSERT_EQ(decimated_line.size(), 2);
+  EXPECT_FLOAT_EQ(decimated_line.front().x(), straight_line.front().x());
+  EXPECT_FLOAT_EQ(decimated_line.back().y(), straight_line.back().y());
+
+  // Corner points survive the decimation
+  CartesianPoints2D l_shape;
+  for (int i = 0; i <= 10; i++) {
+    l_shape.emplace_back(0.5 * i, 0.0);
+  }
+  for (int i = 1; i <= 10; i++) {
+    l_shape.emplace_back(5.0, 0.5 * i);
+  }
+  const auto decimated_l_shape = DecimatePoints(l_shape, 0.05);
+  ASSERT_EQ(decimated_l_shape.size(), 3);
+  EXPECT_FLOAT_EQ(decimated_l_shape[1].x(), 5.0);
+  EXPECT_FLOAT_EQ(decimated_l_shape[1].y(), 0.0);
+
+  // The curved heart-shaped reference line keeps its density
+  const auto decimated_refline = DecimatePoints(refline_, 0.05);
+  EXPECT_EQ(decimated_refline.size(), refline_.size());
+
+  // Degenerate inputs are returned unchanged
+  CartesianPoints2D two_points{refline_[0], refline_[1]};
+  EXPECT_EQ(DecimatePoints(two_points, 0.5).size(), 2);
+}
+
+namespace {
+int projection_error_callback_calls = 0;
+void CountProjectionErrors(const ProjectionError /*error*/,
+                           const DataIdx /*segment_idx*/) {
+  projection_error_callback_calls++;
+}
+}  // namespace
+
+TEST_F(CubicSplineUtilitiesTest, ProjectionErrorReporting) {  // NOLINT
+  DataMatrix<RealType> data = NaturalSplineDataMatrixFromPoints(refline_);
+
+  // Well-conditioned projections don't trip the error channel, with or
+  // without an installed callback
+  const auto count_before = ProjectionErrorCount();
+  projection_error_callback_calls = 0;
+  SetProjectionErrorCallback(&CountProjectionErrors);
+
+  const auto frenet_frames = ConstructFrenetFrames(data, point_);
+  EXPECT_EQ(frenet_frames.size(), 3);
+  EXPECT_EQ(ProjectionErrorCount(), count_before);
+  EXPECT_EQ(projection_error_callback_calls, 0);
+
+  // Uninstalling restores the counter-only default
+  SetProjectionErrorCallback(nullptr);
+  ConstructFrenetFrames(data, point_);
+  EXPECT_EQ(ProjectionErrorCount(), count_before);
+}
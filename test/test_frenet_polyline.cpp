@@ -93,6 +93,24 @@ TEST_F(FrenetPolylineTest, Curved) {
   EXPECT_FLOAT_EQ(right_polyline[8].d(), -1.4117645);
 }
 
+TEST_F(FrenetPolylineTest, BatchedProjection) {
+  const auto& boundary = curved_lanelet_.left_boundary;
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> points(2, boundary.size());
+  for (std::size_t i = 0; i < boundary.size(); i++) {
+    points.col(i) = boundary[i];
+  }
+
+  const auto batched_polyline = curved_cubic_spline_.projectPoints(points);
+  const auto reference_polyline =
+      curved_cubic_spline_.toFrenetPolyline(boundary);
+
+  ASSERT_EQ(batched_polyline.size(), reference_polyline.size());
+  for (int i = 0, n = batched_polyline.size(); i < n; i++) {
+    EXPECT_FLOAT_EQ(batched_polyline[i].l(), reference_polyline[i].l());
+    EXPECT_FLOAT_EQ(batched_polyline[i].d(), reference_polyline[i].d());
+  }
+}
+
 TEST_F(FrenetPolylineTest, Interpolation) {
   auto left_polyline =
       curved_cubic_spline_.toFrenetPolyline(curved_lanelet_.left_boundary);
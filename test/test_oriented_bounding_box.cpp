@@ -0,0 +1,39 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "corridor/internal/oriented_bounding_box.h"
+
+using namespace corridor;
+
+TEST(OrientedBoundingBox, precomputedProjections) {
+  // The precomputed projections match the direct trigonometric evaluation
+  for (RealType orientation = -M_PI; orientation <= M_PI; orientation += 0.3) {
+    const RealType length = 4.2;
+    const RealType width = 1.8;
+    const OrientedBoundingBox obb(orientation, length, width);
+
+    const RealType cos = std::cos(orientation);
+    const RealType sin = std::sin(orientation);
+    const RealType expected_x1 = std::abs(cos * length + sin * width);
+    const RealType expected_x2 = std::abs(sin * length + cos * width);
+
+    EXPECT_DOUBLE_EQ(obb.projectionX1(), expected_x1);
+    EXPECT_DOUBLE_EQ(obb.projectionX2(), expected_x2);
+    EXPECT_DOUBLE_EQ(obb.projection().first, expected_x1);
+    EXPECT_DOUBLE_EQ(obb.projection().second, expected_x2);
+  }
+}
+
+TEST(OrientedBoundingBox, copyKeepsProjections) {
+  const OrientedBoundingBox obb({0.7, 0.1}, {4.0, 0.2}, {2.0, 0.1});
+  const OrientedBoundingBox copy(obb);
+  EXPECT_DOUBLE_EQ(copy.projectionX1(), obb.projectionX1());
+  EXPECT_DOUBLE_EQ(copy.projectionX2(), obb.projectionX2());
+}
+
+TEST(OrientedBoundingBox, defaultConstructed) {
+  const OrientedBoundingBox obb;
+  EXPECT_DOUBLE_EQ(obb.projectionX1(), 0.0);
+  EXPECT_DOUBLE_EQ(obb.projectionX2(), 0.0);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include "corridor/projection_cache.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+
+class ProjectionCacheTest : public ::testing::Test {
+ public:
+  void SetUp() override {
+    corridor_ = std::make_shared<Corridor>(1, curved_lanelet_.centerline,
+                                           curved_lanelet_.left_boundary,
+                                           curved_lanelet_.right_boundary);
+  }
+
+  CurvedLanelet curved_lanelet_;
+  CorridorPtr corridor_;
+};
+
+TEST_F(ProjectionCacheTest, repeatedQueriesHitAndStayExact) {
+  ProjectionCache cache;
+  const CartesianPoint2D static_obstacle(2.0, 2.5);
+
+  const auto uncached = corridor_->getFrenetPositionWithFrame(static_obstacle);
+  const auto first = cache.getFrenetPositionWithFrame(*corridor_,
+                                                      static_obstacle);
+  EXPECT_EQ(cache.hits(), 0);
+  EXPECT_EQ(cache.misses(), 1);
+
+  // The same point queried again each "cycle" hits and returns the exact
+  // uncached result
+  for (int cycle = 0; cycle < 10; cycle++) {
+    const auto cached =
+        cache.getFrenetPositionWithFrame(*corridor_, static_obstacle);
+    EXPECT_EQ(cached.position.l(), uncached.position.l());
+    EXPECT_EQ(cached.position.d(), uncached.position.d());
+    EXPECT_EQ(cached.frame.arc_length(), uncached.frame.arc_length());
+  }
+  EXPECT_EQ(cache.hits(), 10);
+  EXPECT_EQ(cache.misses(), 1);
+  EXPECT_EQ(first.position.l(), uncached.position.l());
+}
+
+TEST_F(ProjectionCacheTest, nearbyPointsInSameCellAreNotConflated) {
+  // Coarse cells on purpose: both points quantize to the same cell
+  ProjectionCache cache(1.0);
+  const CartesianPoint2D point_a(2.01, 2.02);
+  const CartesianPoint2D point_b(2.03, 2.04);
+
+  const auto result_a = cache.getFrenetPositionWithFrame(*corridor_, point_a);
+  const auto result_b = cache.getFrenetPositionWithFrame(*corridor_, point_b);
+  EXPECT_EQ(cache.misses(), 2);
+
+  // Quantization only buckets; results are always the exact projection
+  const auto exact_a = corridor_->getFrenetPositionWithFrame(point_a);
+  const auto exact_b = corridor_->getFrenetPositionWithFrame(point_b);
+  EXPECT_EQ(result_a.position.l(), exact_a.position.l());
+  EXPECT_EQ(result_b.position.l(), exact_b.position.l());
+  EXPECT_NE(result_a.position.l(), result_b.position.l());
+}
+
+TEST_F(ProjectionCacheTest, boundedSizeAndClear) {
+  ProjectionCache cache(0.1, 16);
+  EXPECT_EQ(cache.capacity(), 16);
+
+  // Far more distinct points than slots: the cache overwrites instead of
+  // growing
+  for (int i = 0; i < 200; i++) {
+    cache.getFrenetPositionWithFrame(*corridor_,
+                                     CartesianPoint2D(0.05 * i, 1.0));
+  }
+  EXPECT_EQ(cache.capacity(), 16);
+  EXPECT_EQ(cache.hits() + cache.misses(), 200);
+
+  cache.clear();
+  EXPECT_EQ(cache.hits(), 0);
+  EXPECT_EQ(cache.misses(), 0);
+  cache.getFrenetPositionWithFrame(*corridor_, CartesianPoint2D(1.0, 1.0));
+  EXPECT_EQ(cache.misses(), 1);
+}
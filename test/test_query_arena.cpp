@@ -0,0 +1,98 @@
+#include <gtest/gtest.h>
+
+#include "corridor/cubic_spline/cubic_interpolation_2d.h"
+#include "corridor/cubic_spline/cubic_spline_utilities.h"
+#include "corridor/internal/arena.h"
+
+using namespace corridor;
+using namespace cubic_spline;
+
+TEST(QueryArenaTest, AllocateAlignAndReset) {  // NOLINT
+  QueryArena arena(64);
+
+  void* const first = arena.allocate(24, 8);
+  ASSERT_NE(first, nullptr);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(first) % 8, 0);
+  EXPECT_TRUE(arena.owns(first));
+  EXPECT_EQ(arena.bytesUsed(), 24);
+
+  void* const second = arena.allocate(8, 8);
+  EXPECT_EQ(static_cast<unsigned char*>(second),
+            static_cast<unsigned char*>(first) + 24);
+
+  // A request beyond the chunk capacity grows the arena instead of failing
+  void* const large = arena.allocate(1024, 8);
+  ASSERT_NE(large, nullptr);
+  EXPECT_TRUE(arena.owns(large));
+
+  // reset rewinds: the first chunk is handed out again
+  arena.reset();
+  EXPECT_EQ(arena.bytesUsed(), 0);
+  EXPECT_EQ(arena.allocate(24, 8), first);
+}
+
+TEST(QueryArenaTest, ArenaVectorDrawsFromActiveArena) {  // NOLINT
+  QueryArena arena;
+
+  // Without an active arena the allocator falls back to the heap
+  {
+    ArenaVector<double> heap_backed(100, 1.0);
+    EXPECT_FALSE(arena.owns(heap_backed.data()));
+  }
+  EXPECT_EQ(arena.bytesUsed(), 0);
+
+  // Inside the scope, allocations come from the arena
+  {
+    ScopedQueryArena scope(arena);
+    ArenaVector<double> arena_backed(100, 2.0);
+    EXPECT_TRUE(arena.owns(arena_backed.data()));
+    EXPECT_GE(arena.bytesUsed(), 100 * sizeof(double));
+  }
+  arena.reset();
+}
+
+TEST(QueryArenaTest, ScopesNest) {  // NOLINT
+  QueryArena outer_arena;
+  QueryArena inner_arena;
+
+  ScopedQueryArena outer_scope(outer_arena);
+  {
+    ScopedQueryArena inner_scope(inner_arena);
+    ArenaVector<int> values(10, 1);
+    EXPECT_TRUE(inner_arena.owns(values.data()));
+    EXPECT_FALSE(outer_arena.owns(values.data()));
+  }
+  // The outer arena is active again after the inner scope ends
+  ArenaVector<int> values(10, 2);
+  EXPECT_TRUE(outer_arena.owns(values.data()));
+}
+
+TEST(QueryArenaTest, BatchProjectionUnchangedUnderArena) {  // NOLINT
+  CartesianPoints2D refline;
+  for (int i = 0; i <= 20; i++) {
+    refline.emplace_back(2.0 * i, 3.0 * std::sin(0.1 * i));
+  }
+  const DataMatrix<RealType> data = NaturalSplineDataMatrixFromPoints(refline);
+  const SplineCoefficients2d coefficients =
+      SplineCoefficientsFromDataMatrix(data);
+
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> points(2, 50);
+  for (int i = 0; i < 50; i++) {
+    points.col(i) << 0.8 * i, 2.0 - 0.1 * i;
+  }
+
+  const FrenetPolyline reference =
+      ConvertToFrenetPolyline(data, coefficients, points);
+
+  QueryArena arena;
+  ScopedQueryArena scope(arena);
+  const FrenetPolyline under_arena =
+      ConvertToFrenetPolyline(data, coefficients, points);
+  EXPECT_GT(arena.bytesUsed(), 0);
+
+  ASSERT_EQ(under_arena.size(), reference.size());
+  for (int i = 0; i < reference.size(); i++) {
+    EXPECT_FLOAT_EQ(under_arena.GetPoint(i).l(), reference.GetPoint(i).l());
+    EXPECT_FLOAT_EQ(under_arena.GetPoint(i).d(), reference.GetPoint(i).d());
+  }
+}
@@ -0,0 +1,75 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "corridor/cubic_spline/spline_projector.h"
+#include "lanelet_mock.hpp"
+
+using namespace corridor;
+using namespace cubic_spline;
+
+class SplineProjectorTest : public ::testing::Test {
+  void SetUp() override {
+    straight_cubic_spline_ = CubicSpline(1, straight_lanelet_.centerline);
+    curved_cubic_spline_ = CubicSpline(2, curved_lanelet_.centerline);
+  }
+
+ public:
+  StraightLanelet straight_lanelet_;
+  CurvedLanelet curved_lanelet_;
+  CubicSpline straight_cubic_spline_;
+  CubicSpline curved_cubic_spline_;
+};
+
+TEST_F(SplineProjectorTest, MatchesGlobalSearch) {
+  SplineProjector projector(&curved_cubic_spline_);
+
+  // Sample a track moving along the corridor in small steps and compare each
+  // warm-started projection against the global search.
+  const RealType total_length = curved_cubic_spline_.GetTotalLength();
+  for (RealType arc_length = 0.0; arc_length <= total_length;
+       arc_length += 0.1) {
+    const CartesianPoint2D position =
+        curved_cubic_spline_.GetPositionAt(arc_length) +
+        0.5 * curved_cubic_spline_.GetNormalVectorAt(arc_length);
+
+    const auto warm = projector.project(position);
+    const auto cold = curved_cubic_spline_.getFrenetPositionWithFrame(position);
+
+    EXPECT_NEAR(warm.position.l(), cold.position.l(), 1e-3);
+    EXPECT_NEAR(warm.position.d(), cold.position.d(), 1e-3);
+  }
+}
+
+TEST_F(SplineProjectorTest, ClampsBeyondSplineEnds) {
+  SplineProjector projector(&straight_cubic_spline_);
+
+  // Seed the warm start somewhere in the middle of the spline
+  projector.project(straight_cubic_spline_.GetPositionAt(2.0));
+
+  // Point before the spline start
+  const CartesianPoint2D before(-2.0, -2.0);
+  const auto projection_before = projector.project(before);
+  EXPECT_NEAR(projection_before.position.l(), -M_SQRT2 * 2.0, 1e-3);
+
+  // Point behind the spline end
+  const RealType total_length = straight_cubic_spline_.GetTotalLength();
+  const CartesianPoint2D behind(8.0, 8.0);
+  const auto projection_behind = projector.project(behind);
+  EXPECT_NEAR(projection_behind.position.l(),
+              total_length + M_SQRT2 * (8.0 - 6.0), 1e-3);
+}
+
+TEST_F(SplineProjectorTest, ResetDiscardsWarmStart) {
+  SplineProjector projector(&straight_cubic_spline_);
+  projector.project(straight_cubic_spline_.GetPositionAt(3.0));
+
+  projector.reset(&curved_cubic_spline_);
+  EXPECT_EQ(projector.spline(), &curved_cubic_spline_);
+
+  const CartesianPoint2D position = curved_cubic_spline_.GetPositionAt(5.0);
+  const auto warm = projector.project(position);
+  const auto cold = curved_cubic_spline_.getFrenetPositionWithFrame(position);
+  EXPECT_NEAR(warm.position.l(), cold.position.l(), 1e-3);
+  EXPECT_NEAR(warm.position.d(), cold.position.d(), 1e-3);
+}
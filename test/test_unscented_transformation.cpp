@@ -1,6 +1,7 @@
 #include <gtest/gtest.h>
 
 #include "corridor/internal/oriented_bounding_box.h"
+#include "corridor/unscented_transformation/polar_coordinate_transformation.h"
 #include "corridor/unscented_transformation/sigma_points.h"
 #include "corridor/unscented_transformation/unscented_transformation.h"
 
@@ -64,4 +65,197 @@ TEST_F(UnscentedTransformationTest, UT_boxTransformation) {
 
   std::cout << "/* transformed_covMat */" << std::endl;
   std::cout << transformed_state.covMat << std::endl;
+}
+
+TEST_F(UnscentedTransformationTest, BatchPolarTransformation) {
+  // A batch of velocity states with varying means and covariances
+  const int num_states = 9;
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> means(2, num_states);
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> cov_mats(2, 2 * num_states);
+  for (int i = 0; i < num_states; i++) {
+    means.col(i) << 2.0 + 0.5 * i, -3.0 + 0.7 * i;
+    Eigen::Matrix2d cov;
+    cov << 0.5 + 0.05 * i, 0.1, 0.1, 0.3 + 0.02 * i;
+    cov_mats.block<2, 2>(0, 2 * i) = cov;
+  }
+
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> batch_means;
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> batch_cov_mats;
+  ToPolarCoordinates2D(means, cov_mats, &batch_means, &batch_cov_mats);
+
+  ASSERT_EQ(batch_means.cols(), num_states);
+  ASSERT_EQ(batch_cov_mats.cols(), 2 * num_states);
+
+  // The batch results match the per-state transformation exactly
+  for (int i = 0; i < num_states; i++) {
+    PolarVector2D polar_mean;
+    PolarCovarianceMatrix2D polar_cov;
+    ToPolarCoordinates2D(means.col(i), cov_mats.block<2, 2>(0, 2 * i),
+                         &polar_mean, &polar_cov);
+    EXPECT_TRUE(batch_means.col(i).isApprox(polar_mean)) << "state " << i;
+    EXPECT_TRUE((batch_cov_mats.block<2, 2>(0, 2 * i).isApprox(polar_cov)))
+        << "state " << i;
+  }
+}
+
+TEST_F(UnscentedTransformationTest, BatchPolarRoundTrip) {
+  const int num_states = 4;
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> means(2, num_states);
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> cov_mats(2, 2 * num_states);
+  for (int i = 0; i < num_states; i++) {
+    means.col(i) << 4.0 + i, 1.0 - 0.3 * i;
+    cov_mats.block<2, 2>(0, 2 * i) = Eigen::Matrix2d::Identity() * 0.05;
+  }
+
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> polar_means;
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> polar_cov_mats;
+  ToPolarCoordinates2D(means, cov_mats, &polar_means, &polar_cov_mats);
+
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> cartesian_means;
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> cartesian_cov_mats;
+  FromPolarCoordinates2D(polar_means, polar_cov_mats, &cartesian_means,
+                         &cartesian_cov_mats);
+
+  // For small uncertainties the round trip reproduces the initial means
+  for (int i = 0; i < num_states; i++) {
+    EXPECT_NEAR((cartesian_means.col(i) - means.col(i)).norm(), 0.0, 1e-2)
+        << "state " << i;
+  }
+}
+
+TEST_F(UnscentedTransformationTest, PersistentSigmaPointsFreshFactorization) {
+  // The first call factorizes from scratch and must match the plain
+  // generator exactly
+  PersistentMerweScaledSigmaPoints<3> persistent;
+  const auto& sigmas = persistent.generateSigmaPoints(initial_state_.mean,
+                                                      initial_state_.covMat);
+  const auto& reference = sigma_points_.generateSigmaPoints(
+      initial_state_.mean, initial_state_.covMat);
+  EXPECT_EQ((sigmas - reference).norm(), 0.0);
+  EXPECT_EQ((persistent.weightsMean() - sigma_points_.weightsMean()).norm(),
+            0.0);
+}
+
+TEST_F(UnscentedTransformationTest, PersistentSigmaPointsTracksSmallDrift) {
+  PersistentMerweScaledSigmaPoints<3> persistent;
+  Eigen::MatrixXd cov_mat = initial_state_.covMat;
+  persistent.generateSigmaPoints(initial_state_.mean, cov_mat);
+
+  // Simulate steady-state tracking: 0.2% covariance drift per cycle stays
+  // on the low-rank update path and within tolerance of the exact factor
+  for (int cycle = 0; cycle < 50; cycle++) {
+    cov_mat *= 1.002;
+    cov_mat(0, 1) += 1e-4;
+    cov_mat(1, 0) += 1e-4;
+    const auto& sigmas =
+        persistent.generateSigmaPoints(initial_state_.mean, cov_mat);
+    const auto& reference =
+        sigma_points_.generateSigmaPoints(initial_state_.mean, cov_mat);
+    EXPECT_LT((sigmas - reference).norm(), 1e-4) << "cycle " << cycle;
+  }
+}
+
+TEST_F(UnscentedTransformationTest, PersistentSigmaPointsRefactorizeOnJump) {
+  PersistentMerweScaledSigmaPoints<3> persistent;
+  persistent.generateSigmaPoints(initial_state_.mean, initial_state_.covMat);
+
+  // A large covariance change must trigger a full refactorization and again
+  // match the plain generator exactly
+  const Eigen::MatrixXd jumped = initial_state_.covMat * 4.0;
+  const auto& sigmas =
+      persistent.generateSigmaPoints(initial_state_.mean, jumped);
+  const auto& reference =
+      sigma_points_.generateSigmaPoints(initial_state_.mean, jumped);
+  EXPECT_EQ((sigmas - reference).norm(), 0.0);
+
+  // The same holds after an explicit reset
+  persistent.reset();
+  const auto& after_reset =
+      persistent.generateSigmaPoints(initial_state_.mean, jumped);
+  EXPECT_EQ((after_reset - reference).norm(), 0.0);
+}
+
+namespace {
+// Reference unscented polar transformation, built from the public sigma
+// point API to validate the dispatching fast path
+void ReferenceUnscentedToPolar(const Eigen::Vector2d& x,
+                               const Eigen::Matrix2d& P,
+                               PolarVector2D* polar_mean,
+                               PolarCovarianceMatrix2D* polar_cov) {
+  MerweScaledSigmaPoints<2> generator;
+  const auto& sigmas = generator.generateSigmaPoints(x, P);
+  Eigen::MatrixXd transformed(2, sigmas.cols());
+  for (int i = 0; i < sigmas.cols(); i++) {
+    transformed.col(i) = CartesianToPolarTransformation2D(sigmas.col(i));
+  }
+  EstimateStateMeanAndCovarianceMatrix(transformed, generator.weightsMean(),
+                                       generator.weightsCovMat(), (*polar_mean),
+                                       (*polar_cov), 1);
+}
+}  // namespace
+
+TEST_F(UnscentedTransformationTest, LinearizedFastPathCloseToUT) {
+  // Small uncertainty relative to the magnitude: the linearized fast path is
+  // taken and must stay within tolerance of the unscented transformation
+  const Eigen::Vector2d mean(10.0, 5.0);
+  const Eigen::Matrix2d cov = Eigen::Matrix2d::Identity() * 0.01;
+
+  PolarVector2D polar_mean;
+  PolarCovarianceMatrix2D polar_cov;
+  ToPolarCoordinates2D(mean, cov, &polar_mean, &polar_cov);
+
+  PolarVector2D reference_mean;
+  PolarCovarianceMatrix2D reference_cov;
+  ReferenceUnscentedToPolar(mean, cov, &reference_mean, &reference_cov);
+
+  // The UT radius mean carries a second-order bias term of about
+  // trace(P) / (2 r); with the criterion's 1% relative variance bound the
+  // two estimates agree to ~1e-3
+  EXPECT_NEAR(polar_mean(0), reference_mean(0), 1e-3);
+  EXPECT_NEAR(polar_mean(1), reference_mean(1), 1e-3);
+  EXPECT_NEAR(polar_cov(0, 0), reference_cov(0, 0), 1e-4);
+  EXPECT_NEAR(polar_cov(1, 1), reference_cov(1, 1), 1e-4);
+  EXPECT_NEAR(polar_cov(0, 1), reference_cov(0, 1), 1e-4);
+}
+
+TEST_F(UnscentedTransformationTest, NonlinearityCriterionFallsBackToUT) {
+  // Large relative uncertainty: the dispatch must reproduce the unscented
+  // transformation exactly
+  {
+    const Eigen::Vector2d mean(1.0, 0.0);
+    const Eigen::Matrix2d cov = Eigen::Matrix2d::Identity() * 0.5;
+    PolarVector2D polar_mean;
+    PolarCovarianceMatrix2D polar_cov;
+    ToPolarCoordinates2D(mean, cov, &polar_mean, &polar_cov);
+
+    PolarVector2D reference_mean;
+    PolarCovarianceMatrix2D reference_cov;
+    ReferenceUnscentedToPolar(mean, cov, &reference_mean, &reference_cov);
+    EXPECT_TRUE(polar_mean.isApprox(reference_mean));
+    EXPECT_TRUE(polar_cov.isApprox(reference_cov));
+  }
+  // Radius close to zero: linearization is singular, UT must be used
+  {
+    const Eigen::Vector2d mean(1e-4, 0.0);
+    const Eigen::Matrix2d cov = Eigen::Matrix2d::Identity() * 0.1;
+    PolarVector2D polar_mean;
+    PolarCovarianceMatrix2D polar_cov;
+    ToPolarCoordinates2D(mean, cov, &polar_mean, &polar_cov);
+
+    PolarVector2D reference_mean;
+    PolarCovarianceMatrix2D reference_cov;
+    ReferenceUnscentedToPolar(mean, cov, &reference_mean, &reference_cov);
+    EXPECT_TRUE(polar_mean.isApprox(reference_mean));
+    EXPECT_TRUE(polar_cov.isApprox(reference_cov));
+  }
+}
+
+TEST_F(UnscentedTransformationTest, BatchPolarEmptyInput) {
+  const Eigen::Matrix<RealType, 2, Eigen::Dynamic> means(2, 0);
+  const Eigen::Matrix<RealType, 2, Eigen::Dynamic> cov_mats(2, 0);
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> resulting_means(2, 3);
+  Eigen::Matrix<RealType, 2, Eigen::Dynamic> resulting_cov_mats(2, 6);
+  ToPolarCoordinates2D(means, cov_mats, &resulting_means, &resulting_cov_mats);
+  EXPECT_EQ(resulting_means.cols(), 0);
+  EXPECT_EQ(resulting_cov_mats.cols(), 0);
 }
\ No newline at end of file